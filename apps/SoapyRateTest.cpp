@@ -4,6 +4,7 @@
 #include <SoapySDR/Device.hpp>
 #include <SoapySDR/Formats.hpp>
 #include <SoapySDR/Errors.hpp>
+#include <SoapySDR/Buffer.hpp>
 #include <string>
 #include <cstdlib>
 #include <iostream>
@@ -27,9 +28,15 @@ void runRateTestStreamLoop(
 {
     //allocate buffers for the stream read/write
     const size_t numElems = device->getStreamMTU(stream);
-    std::vector<std::vector<char>> buffMem(numChans, std::vector<char>(elemSize*numElems));
+    SoapySDR::BufferArgs buffArgs;
+    buffArgs.numaNode = SoapySDR::getNumaNode(device, direction, 0);
+    std::vector<SoapySDR::Buffer> buffMem;
     std::vector<void *> buffs(numChans);
-    for (size_t i = 0; i < numChans; i++) buffs[i] = buffMem[i].data();
+    for (size_t i = 0; i < numChans; i++)
+    {
+        buffMem.emplace_back(elemSize*numElems, buffArgs);
+        buffs[i] = buffMem[i].data();
+    }
 
     //state collected in this loop
     unsigned int overflows(0);
@@ -0,0 +1,291 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Version.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/ConverterPlan.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <algorithm> //min, max
+#include <cstdlib>
+#include <cstddef>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <fstream>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <getopt.h>
+
+/***********************************************************************
+ * One measurement of a converter function
+ **********************************************************************/
+struct BenchResult
+{
+    std::string source;
+    std::string target;
+    SoapySDR::ConverterRegistry::FunctionPriority priority;
+    size_t bufferBytes;
+    size_t numElems;
+    size_t numThreads;
+    double elemsPerSec;
+    double bytesPerSec;
+};
+
+static std::string priorityToString(const SoapySDR::ConverterRegistry::FunctionPriority priority)
+{
+    switch (priority)
+    {
+    case SoapySDR::ConverterRegistry::GENERIC: return "GENERIC";
+    case SoapySDR::ConverterRegistry::VECTORIZED: return "VECTORIZED";
+    case SoapySDR::ConverterRegistry::CUSTOM: return "CUSTOM";
+    }
+    return std::to_string(int(priority));
+}
+
+static std::string bytesToString(const size_t bytes)
+{
+    if (bytes >= (1 << 20)) return std::to_string(bytes >> 20) + " MiB";
+    if (bytes >= (1 << 10)) return std::to_string(bytes >> 10) + " KiB";
+    return std::to_string(bytes) + " B";
+}
+
+//random integer samples, and in-range values for floating point sources
+static void fillSource(const std::string &format, std::vector<char> &buff)
+{
+    std::srand(1);
+    for (auto &b : buff) b = char(std::rand());
+
+    const bool isComplex = not format.empty() and format[0] == 'C';
+    if (format.find('F') == std::string::npos) return;
+    const size_t componentSize = SoapySDR::formatToSize(format)/(isComplex?2:1);
+    if (componentSize == sizeof(float))
+    {
+        auto *p = (float *)buff.data();
+        for (size_t i = 0; i < buff.size()/sizeof(float); i++) p[i] = float(std::rand())/RAND_MAX - 0.5f;
+    }
+    if (componentSize == sizeof(double))
+    {
+        auto *p = (double *)buff.data();
+        for (size_t i = 0; i < buff.size()/sizeof(double); i++) p[i] = double(std::rand())/RAND_MAX - 0.5;
+    }
+}
+
+/***********************************************************************
+ * Time a converter over a buffer of the given size
+ **********************************************************************/
+static BenchResult benchConverter(
+    const std::string &source,
+    const std::string &target,
+    const SoapySDR::ConverterRegistry::FunctionPriority priority,
+    const size_t bufferBytes,
+    const size_t numThreads,
+    const double minSeconds)
+{
+    const SoapySDR::ConverterPlan plan(source, target, priority);
+    const size_t srcSize = SoapySDR::formatToSize(source);
+    const size_t dstSize = SoapySDR::formatToSize(target);
+
+    //the buffer size counts the input and the output which both pass through the cache
+    const size_t numElems = std::max<size_t>(1, bufferBytes/(srcSize+dstSize));
+    std::vector<char> src(numElems*srcSize), dst(numElems*dstSize);
+    fillSource(source, src);
+
+    //warm up the cache and the branch predictors, and start the workers
+    plan.executeParallel(src.data(), dst.data(), numElems, numThreads);
+
+    size_t numCalls = 0;
+    double seconds = 0.0;
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    do
+    {
+        plan.executeParallel(src.data(), dst.data(), numElems, numThreads);
+        numCalls++;
+        seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t0).count();
+    } while (seconds < minSeconds);
+
+    BenchResult result;
+    result.source = source;
+    result.target = target;
+    result.priority = priority;
+    result.bufferBytes = bufferBytes;
+    result.numElems = numElems;
+    result.numThreads = numThreads;
+    result.elemsPerSec = (numCalls*numElems)/seconds;
+    result.bytesPerSec = result.elemsPerSec*(srcSize+dstSize);
+    return result;
+}
+
+/***********************************************************************
+ * Report formatting
+ **********************************************************************/
+static void printTable(const std::vector<BenchResult> &results)
+{
+    std::cout << std::left
+        << std::setw(8) << "Source"
+        << std::setw(8) << "Target"
+        << std::setw(12) << "Priority"
+        << std::right
+        << std::setw(10) << "Buffer"
+        << std::setw(9) << "Threads"
+        << std::setw(12) << "Msamples/s"
+        << std::setw(12) << "MBytes/s" << std::endl;
+    for (const auto &r : results)
+    {
+        std::cout << std::left
+            << std::setw(8) << r.source
+            << std::setw(8) << r.target
+            << std::setw(12) << priorityToString(r.priority)
+            << std::right
+            << std::setw(10) << bytesToString(r.bufferBytes)
+            << std::setw(9) << r.numThreads
+            << std::setw(12) << std::fixed << std::setprecision(1) << r.elemsPerSec/1e6
+            << std::setw(12) << std::fixed << std::setprecision(1) << r.bytesPerSec/1e6 << std::endl;
+    }
+}
+
+static std::string toJSON(const std::vector<BenchResult> &results)
+{
+    std::stringstream ss;
+    ss << "{\n";
+    ss << "  \"version\": \"" << SoapySDR::getLibVersion() << "\",\n";
+    ss << "  \"cpuFeatures\": " << SoapySDR::ConverterRegistry::getCPUFeatures() << ",\n";
+    ss << "  \"results\": [";
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const auto &r = results[i];
+        ss << ((i == 0)?"\n":",\n");
+        ss << "    {\"source\": \"" << r.source << "\", "
+           << "\"target\": \"" << r.target << "\", "
+           << "\"priority\": \"" << priorityToString(r.priority) << "\", "
+           << "\"bufferBytes\": " << r.bufferBytes << ", "
+           << "\"numElems\": " << r.numElems << ", "
+           << "\"numThreads\": " << r.numThreads << ", "
+           << "\"samplesPerSec\": " << std::fixed << std::setprecision(0) << r.elemsPerSec << ", "
+           << "\"bytesPerSec\": " << std::fixed << std::setprecision(0) << r.bytesPerSec << "}";
+    }
+    ss << "\n  ]\n}\n";
+    return ss.str();
+}
+
+/***********************************************************************
+ * Print help message
+ **********************************************************************/
+static int printHelp(void)
+{
+    std::cout << "Usage SoapySDRConverterBench [options]" << std::endl;
+    std::cout << "  Options summary:" << std::endl;
+    std::cout << "    --help \t\t\t\t Print this help message" << std::endl;
+    std::cout << "    --source=\"CS16\" \t\t\t Only benchmark this source format" << std::endl;
+    std::cout << "    --target=\"CF32\" \t\t\t Only benchmark this target format" << std::endl;
+    std::cout << "    --sizes=\"16384,262144,...\" \t Buffer sizes in bytes of input plus output" << std::endl;
+    std::cout << "    --threads=\"1,2,4\" \t\t Thread counts for ConverterPlan::executeParallel()" << std::endl;
+    std::cout << "    --time=\"0.02\" \t\t\t Minimum seconds per measurement" << std::endl;
+    std::cout << "    --json=\"results.json\" \t\t Also write the results as JSON, \"-\" for stdout" << std::endl;
+    std::cout << std::endl;
+    return EXIT_SUCCESS;
+}
+
+/***********************************************************************
+ * main utility entry point
+ **********************************************************************/
+int main(int argc, char *argv[])
+{
+    std::string sourceFilter;
+    std::string targetFilter;
+    std::string jsonPath;
+    double minSeconds = 0.02;
+
+    //from L1-resident up to DRAM-sized working sets
+    std::vector<size_t> sizes{16 << 10, 256 << 10, 4 << 20, 64 << 20};
+
+    //executeParallel() with one thread converts on the calling thread
+    std::vector<size_t> threads{1};
+
+    /*******************************************************************
+     * parse command line options
+     ******************************************************************/
+    static struct option long_options[] = {
+        {"help", no_argument, nullptr, 'h'},
+        {"source", required_argument, nullptr, 's'},
+        {"target", required_argument, nullptr, 't'},
+        {"sizes", required_argument, nullptr, 'z'},
+        {"threads", required_argument, nullptr, 'n'},
+        {"time", required_argument, nullptr, 'T'},
+        {"json", required_argument, nullptr, 'j'},
+        {nullptr, no_argument, nullptr, '\0'}
+    };
+    int long_index = 0;
+    int option = 0;
+    while ((option = getopt_long_only(argc, argv, "", long_options, &long_index)) != -1)
+    {
+        switch (option)
+        {
+        case 'h': return printHelp();
+        case 's': sourceFilter = optarg; break;
+        case 't': targetFilter = optarg; break;
+        case 'T': minSeconds = std::stod(optarg); break;
+        case 'j': jsonPath = optarg; break;
+        case 'z':
+        {
+            sizes.clear();
+            std::stringstream ss(optarg);
+            std::string size;
+            while (std::getline(ss, size, ',')) sizes.push_back(size_t(std::stoull(size)));
+            break;
+        }
+        case 'n':
+        {
+            threads.clear();
+            std::stringstream ss(optarg);
+            std::string count;
+            while (std::getline(ss, count, ',')) threads.push_back(std::max<size_t>(1, size_t(std::stoull(count))));
+            break;
+        }
+        default: return printHelp();
+        }
+    }
+
+    /*******************************************************************
+     * benchmark every registered function
+     ******************************************************************/
+    std::vector<BenchResult> results;
+    for (const auto &source : SoapySDR::ConverterRegistry::listAvailableSourceFormats())
+    {
+        if (not sourceFilter.empty() and source != sourceFilter) continue;
+        if (SoapySDR::formatToSize(source) == 0) continue;
+        for (const auto &target : SoapySDR::ConverterRegistry::listTargetFormats(source))
+        {
+            if (not targetFilter.empty() and target != targetFilter) continue;
+            if (SoapySDR::formatToSize(target) == 0) continue;
+            for (const auto priority : SoapySDR::ConverterRegistry::listPriorities(source, target))
+            {
+                for (const auto size : sizes)
+                {
+                    for (const auto numThreads : threads)
+                    {
+                        results.push_back(benchConverter(source, target, priority, size, numThreads, minSeconds));
+                    }
+                }
+            }
+        }
+    }
+
+    if (jsonPath == "-")
+    {
+        std::cout << toJSON(results);
+        return EXIT_SUCCESS;
+    }
+
+    printTable(results);
+    if (not jsonPath.empty())
+    {
+        std::ofstream out(jsonPath);
+        out << toJSON(results);
+        if (not out)
+        {
+            std::cerr << "Failed to write " << jsonPath << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,77 @@
+///
+/// \file SoapySDR/Buffer.h
+///
+/// Aligned stream buffer allocation with huge pages, locking and NUMA placement.
+///
+/// \copyright
+/// SPDX-License-Identifier: BSL-1.0
+///
+
+#pragma once
+#include <SoapySDR/Config.h>
+#include <SoapySDR/Device.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! The default buffer alignment in bytes, a cache line and the widest SIMD register
+#define SOAPY_SDR_BUFFER_ALIGNMENT 64
+
+/*!
+ * Options for stream buffer allocation.
+ * Initialize with SoapySDRBufferArgs_init() for the defaults.
+ */
+typedef struct
+{
+    //! The alignment in bytes, a power of two
+    size_t alignment;
+
+    //! Back the buffer with huge pages when the system has them
+    bool hugePages;
+
+    //! Lock the buffer in memory so that it is never paged out
+    bool lockMemory;
+
+    //! The NUMA node for the memory, or -1 for the default placement
+    int numaNode;
+} SoapySDRBufferArgs;
+
+/*!
+ * Initialize buffer args with the defaults:
+ * SOAPY_SDR_BUFFER_ALIGNMENT alignment, no huge pages,
+ * no locking and the default NUMA placement.
+ * \param [out] args the buffer args to initialize
+ */
+SOAPY_SDR_API void SoapySDRBufferArgs_init(SoapySDRBufferArgs *args);
+
+/*!
+ * Allocate a stream buffer.
+ * Huge pages, locking and NUMA placement are best effort:
+ * the allocation succeeds without them when the system refuses.
+ * \param size the size of the buffer in bytes
+ * \param args the allocation options, or NULL for the defaults
+ * \return the aligned buffer, or NULL on failure
+ */
+SOAPY_SDR_API void *SoapySDR_allocBuffer(const size_t size, const SoapySDRBufferArgs *args);
+
+/*!
+ * Free a buffer from SoapySDR_allocBuffer().
+ * \param buff the buffer, NULL is ignored
+ */
+SOAPY_SDR_API void SoapySDR_freeBuffer(void *buff);
+
+/*!
+ * Get the NUMA node closest to a device channel, from the "numa_node"
+ * key of the channel info, or else of the hardware info.
+ * \param device a pointer to a device instance
+ * \param direction the channel direction RX or TX
+ * \param channel an available channel on the device
+ * \return the NUMA node, or -1 when the device does not report one
+ */
+SOAPY_SDR_API int SoapySDRDevice_getNumaNode(const SoapySDRDevice *device, const int direction, const size_t channel);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,113 @@
+///
+/// \file SoapySDR/Buffer.hpp
+///
+/// Aligned stream buffer allocation with huge pages, locking and NUMA placement.
+///
+/// \copyright
+/// SPDX-License-Identifier: BSL-1.0
+///
+
+#pragma once
+#include <SoapySDR/Config.hpp>
+#include <SoapySDR/Buffer.h>
+#include <SoapySDR/Device.hpp>
+#include <cstddef>
+
+namespace SoapySDR
+{
+  /*!
+   * Options for stream buffer allocation.
+   * The defaults give a SOAPY_SDR_BUFFER_ALIGNMENT aligned buffer
+   * with the default NUMA placement.
+   */
+  struct SOAPY_SDR_API BufferArgs
+  {
+    BufferArgs(void);
+
+    //! The alignment in bytes, a power of two
+    size_t alignment;
+
+    //! Back the buffer with huge pages when the system has them
+    bool hugePages;
+
+    //! Lock the buffer in memory so that it is never paged out
+    bool lockMemory;
+
+    //! The NUMA node for the memory, or -1 for the default placement
+    int numaNode;
+  };
+
+  /*!
+   * An aligned stream buffer, freed when the buffer is destroyed.
+   * Huge pages, locking and NUMA placement are best effort:
+   * the allocation succeeds without them when the system refuses,
+   * and the getters report what was obtained.
+   */
+  class SOAPY_SDR_API Buffer
+  {
+  public:
+
+    //! Create an empty buffer
+    Buffer(void);
+
+    /*!
+     * Allocate a buffer.
+     * \throws bad_alloc when the memory cannot be allocated
+     * \throws invalid_argument when the alignment is not a power of two
+     * \param size the size of the buffer in bytes
+     * \param args the allocation options
+     */
+    Buffer(const size_t size, const BufferArgs &args = BufferArgs());
+
+    //! Take the memory of another buffer, which becomes empty
+    Buffer(Buffer &&other);
+
+    //! Free this buffer and take the memory of another buffer
+    Buffer &operator=(Buffer &&other);
+
+    //! Free the memory
+    ~Buffer(void);
+
+    //! Get the aligned memory, nullptr for an empty buffer
+    void *data(void) const;
+
+    //! Get the size of the buffer in bytes
+    size_t size(void) const;
+
+    //! Is the buffer backed by huge pages?
+    bool usesHugePages(void) const;
+
+    //! Is the buffer locked in memory?
+    bool isLocked(void) const;
+
+    //! Get the NUMA node that the memory was bound to, or -1
+    int getNumaNode(void) const;
+
+    /*!
+     * Give up ownership of the memory, leaving this buffer empty.
+     * \return the memory, to be freed with free()
+     */
+    void *release(void);
+
+    //! Free memory from release(), nullptr is ignored
+    static void free(void *data);
+
+  private:
+    Buffer(const Buffer &);
+    Buffer &operator=(const Buffer &);
+
+    void *_data;
+    size_t _size;
+  };
+
+  /*!
+   * Get the NUMA node closest to a device channel, from the "numa_node"
+   * key of the channel info, or else of the hardware info.
+   * \param device a pointer to a device instance
+   * \param direction the channel direction RX or TX
+   * \param channel an available channel on the device
+   * \return the NUMA node, or -1 when the device does not report one
+   */
+  SOAPY_SDR_API int getNumaNode(const Device *device, const int direction, const size_t channel);
+
+}
@@ -0,0 +1,231 @@
+///
+/// \file SoapySDR/BufferedStream.hpp
+///
+/// Stream wrappers that service the driver on a background thread.
+///
+/// \copyright
+/// SPDX-License-Identifier: BSL-1.0
+///
+
+#pragma once
+#include <SoapySDR/Config.hpp>
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Buffer.hpp>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+namespace SoapySDR
+{
+  /*!
+   * BufferedRxStream class. A reader thread calls Device::readStream() for the whole
+   * time the stream is active, and stores each chunk in a lock-free single producer,
+   * single consumer ring. The application reads from the ring at its own pace, so a
+   * slow processing iteration only uses up ring space. It does not overflow the driver.
+   *
+   * Every chunk keeps the flags and timestamp from readStream(). Errors from the driver
+   * are queued in order with the chunks, so read() returns SOAPY_SDR_OVERFLOW where
+   * the samples were lost. When the ring is full, the reader keeps draining the driver
+   * and discards those chunks. It counts them as dropped and queues a SOAPY_SDR_OVERFLOW
+   * in their place.
+   *
+   * The wrapper does not own the stream. Call activate(), deactivate() and read() from
+   * one application thread, and do not call Device::readStream() on the stream directly
+   * while the wrapper is active.
+   */
+  class SOAPY_SDR_API BufferedRxStream
+  {
+  public:
+
+    /*!
+     * Wrap a receive stream returned by Device::setupStream().
+     * \throws runtime_error when the depth is zero or the format is unknown
+     * \param device a pointer to a device instance, which must outlive the wrapper
+     * \param stream the opaque pointer to a receive stream handle
+     * \param format the format of the stream, see Device::setupStream()
+     * \param channels the channels of the stream, only the number of channels and the first channel are used
+     * \param depth the number of chunks in the ring
+     * \param chunkElems the number of elements per chunk, 0 for the stream MTU
+     * \param args the ring allocation options, the NUMA node defaults to the first channel's
+     */
+    BufferedRxStream(
+      Device *device,
+      Stream *stream,
+      const std::string &format,
+      const std::vector<size_t> &channels = std::vector<size_t>(),
+      const size_t depth = 16,
+      const size_t chunkElems = 0,
+      const BufferArgs &args = BufferArgs());
+
+    //! Stop the reader thread, the stream is not closed
+    ~BufferedRxStream(void);
+
+    //! Get the number of chunks in the ring
+    size_t getDepth(void) const;
+
+    //! Get the number of elements per chunk
+    size_t getChunkElems(void) const;
+
+    /*!
+     * Activate the stream and start the reader thread, see Device::activateStream().
+     * Chunks left over from the previous activation are discarded.
+     */
+    int activate(const int flags = 0, const long long timeNs = 0, const size_t numElems = 0);
+
+    /*!
+     * Stop the reader thread and deactivate the stream, see Device::deactivateStream().
+     * Chunks that are already in the ring can still be read.
+     */
+    int deactivate(const int flags = 0, const long long timeNs = 0);
+
+    /*!
+     * Read elements from the ring, see Device::readStream().
+     * When a chunk holds more elements than requested, the next call returns
+     * the remainder with SOAPY_SDR_MORE_FRAGMENTS set.
+     * \param buffs an array of buffers, one per channel
+     * \param numElems the number of elements in each buffer
+     * \param [out] flags the flags of the chunk
+     * \param [out] timeNs the timestamp of the first element in nanoseconds
+     * \param timeoutUs the time to wait for a chunk in microseconds
+     * \return the number of elements read per buffer or error code
+     */
+    int read(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs = 100000);
+
+    //! Get the number of chunks that are waiting in the ring
+    size_t getNumBuffered(void) const;
+
+    //! Get the largest number of chunks that were waiting in the ring at once
+    size_t getHighWaterMark(void) const;
+
+    //! Get the number of elements discarded because the ring was full
+    unsigned long long getNumDropped(void) const;
+
+    //! Get the number of SOAPY_SDR_OVERFLOW errors returned by the driver
+    unsigned long long getNumOverflows(void) const;
+
+    //! Reset the high water mark and the drop and overflow counters
+    void resetCounters(void);
+
+  private:
+    //non-copyable: the reader thread refers to the wrapper
+    BufferedRxStream(const BufferedRxStream &);
+    BufferedRxStream &operator=(const BufferedRxStream &);
+
+    struct Impl;
+    Impl *_impl;
+  };
+
+  /*!
+   * BufferedTxStream class. The application queues chunks in a lock-free single producer,
+   * single consumer ring. A feeder thread passes them to Device::writeStream(), so the
+   * driver is fed on time while the application prepares the next samples.
+   *
+   * The feeder activates the stream once the ring holds the prefill number of chunks,
+   * or a chunk that ends a burst. Transmission therefore starts with samples queued
+   * ahead of the driver. Each chunk keeps its flags: the timestamp of a SOAPY_SDR_HAS_TIME
+   * chunk applies only to its first element. SOAPY_SDR_END_BURST goes to the driver
+   * with the last element of the chunk.
+   *
+   * The feeder counts underflows and late chunks from writeStream() and from
+   * Device::readStreamStatus(). It drops a chunk that is late for its timestamp.
+   *
+   * The wrapper does not own the stream. Call activate(), deactivate(), write() and
+   * flush() from one application thread, and do not call Device::writeStream() or
+   * Device::readStreamStatus() on the stream directly while the wrapper is active.
+   */
+  class SOAPY_SDR_API BufferedTxStream
+  {
+  public:
+
+    /*!
+     * Wrap a transmit stream returned by Device::setupStream().
+     * \throws runtime_error when the depth is zero or the format is unknown
+     * \param device a pointer to a device instance, which must outlive the wrapper
+     * \param stream the opaque pointer to a transmit stream handle
+     * \param format the format of the stream, see Device::setupStream()
+     * \param channels the channels of the stream, only the number of channels and the first channel are used
+     * \param depth the number of chunks in the ring
+     * \param chunkElems the maximum number of elements per chunk, 0 for the stream MTU
+     * \param prefill the number of chunks to queue before activating the stream, at most depth
+     * \param args the ring allocation options, the NUMA node defaults to the first channel's
+     */
+    BufferedTxStream(
+      Device *device,
+      Stream *stream,
+      const std::string &format,
+      const std::vector<size_t> &channels = std::vector<size_t>(),
+      const size_t depth = 16,
+      const size_t chunkElems = 0,
+      const size_t prefill = 0,
+      const BufferArgs &args = BufferArgs());
+
+    //! Stop the feeder thread, the stream is not closed
+    ~BufferedTxStream(void);
+
+    //! Get the number of chunks in the ring
+    size_t getDepth(void) const;
+
+    //! Get the maximum number of elements per chunk
+    size_t getChunkElems(void) const;
+
+    //! Get the number of chunks queued before the stream is activated
+    size_t getPrefill(void) const;
+
+    /*!
+     * Start the feeder thread, which activates the stream once the prefill is queued.
+     * The arguments are passed to Device::activateStream(). Chunks written before
+     * this call are transmitted as well. When the deferred activation fails,
+     * write() returns the error code.
+     * \return 0 for success, or the error code of Device::activateStream() without prefill
+     */
+    int activate(const int flags = 0, const long long timeNs = 0, const size_t numElems = 0);
+
+    /*!
+     * Stop the feeder thread and deactivate the stream, see Device::deactivateStream().
+     * Chunks still in the ring are discarded, call flush() first to transmit them.
+     */
+    int deactivate(const int flags = 0, const long long timeNs = 0);
+
+    /*!
+     * Queue elements as one chunk, see Device::writeStream().
+     * When there are more elements than a chunk holds, the chunk takes as many as it
+     * can, and SOAPY_SDR_END_BURST is cleared.
+     * \param buffs an array of buffers, one per channel
+     * \param numElems the number of elements in each buffer
+     * \param [inout] flags input flags and output flags
+     * \param timeNs the timestamp of the first element in nanoseconds
+     * \param timeoutUs the time to wait for a free chunk in microseconds
+     * \return the number of elements queued per buffer or error code
+     */
+    int write(const void * const *buffs, const size_t numElems, int &flags, const long long timeNs = 0, const long timeoutUs = 100000);
+
+    /*!
+     * Wait until the feeder has passed every queued chunk to the driver.
+     * A stream still waiting for its prefill is activated with the chunks queued so far.
+     * \param timeoutUs the timeout in microseconds
+     * \return 0 for success, SOAPY_SDR_TIMEOUT, or the error that stopped the feeder
+     */
+    int flush(const long timeoutUs = 100000);
+
+    //! Get the number of chunks that are waiting in the ring
+    size_t getNumBuffered(void) const;
+
+    //! Get the number of underflows reported by the driver
+    unsigned long long getNumUnderflows(void) const;
+
+    //! Get the number of chunks reported late for their timestamp by the driver
+    unsigned long long getNumLate(void) const;
+
+    //! Reset the underflow and late counters
+    void resetCounters(void);
+
+  private:
+    //non-copyable: the feeder thread refers to the wrapper
+    BufferedTxStream(const BufferedTxStream &);
+    BufferedTxStream &operator=(const BufferedTxStream &);
+
+    struct Impl;
+    Impl *_impl;
+  };
+
+}
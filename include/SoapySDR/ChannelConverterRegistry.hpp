@@ -0,0 +1,104 @@
+///
+/// \file SoapySDR/ChannelConverterRegistry.hpp
+///
+/// Convert between planar and interleaved multi-channel buffers.
+///
+/// \copyright
+/// SPDX-License-Identifier: BSL-1.0
+///
+
+#pragma once
+#include <SoapySDR/Config.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <vector>
+#include <string>
+
+namespace SoapySDR
+{
+  /*!
+   * ChannelConverterRegistry class. The ChannelConverterRegistry maintains
+   * ChannelConverterFunctions which move samples between planar buffers,
+   * one per channel as used by Device::readStream() and Device::writeStream(),
+   * and a single buffer with the channels interleaved element by element.
+   * The functions may change the sample format at the same time.
+   *
+   * Functions are registered and selected by source format, target format,
+   * direction, and priority, in the same way as the ConverterRegistry.
+   */
+  class SOAPY_SDR_API ChannelConverterRegistry
+  {
+  public:
+    /*!
+     * A typedef for declaring a ChannelConverterFunction.
+     * The parameters are (input pointers, output pointers, number of channels,
+     * number of elements per channel, optional scalar).
+     * When interleaving, there is one input pointer per channel and one output pointer.
+     * When deinterleaving, there is one input pointer and one output pointer per channel.
+     * Functions must support any number of channels.
+     */
+    typedef void (*ChannelConverterFunction)(const void * const *, void * const *, const size_t, const size_t, const double);
+
+    /*!
+     * Direction: the layout of the source and target buffers.
+     */
+    enum Direction{
+      INTERLEAVE = 0,       //!< Planar channel buffers to one interleaved buffer.
+      DEINTERLEAVE = 1      //!< One interleaved buffer to planar channel buffers.
+    };
+
+    /*!
+     * Class constructor. Registers a ChannelConverterFunction with a
+     * given source format, target format, direction, priority, and CPU requirements.
+     *
+     * The converter is skipped when the host CPU lacks any of the required features.
+     * When another converter with the same source/target/direction/priority exists,
+     * the one with the most capable feature mask is kept, see ConverterRegistry::CPUFeature.
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param direction interleave or deinterleave
+     * \param priority the FunctionPriority of the converter to register
+     * \param converter function to register
+     * \param cpuFeatures a mask of ConverterRegistry::CPUFeature flags required to run the converter
+     */
+    ChannelConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const Direction direction, const ConverterRegistry::FunctionPriority &priority, ChannelConverterFunction converter, const int cpuFeatures = 0);
+
+    /*!
+     * Get a list of target formats to which the specified source can be converted.
+     * \param sourceFormat the source format markup string
+     * \param direction interleave or deinterleave
+     * \return a vector of target formats or an empty vector if none found
+     */
+    static std::vector<std::string> listTargetFormats(const std::string &sourceFormat, const Direction direction);
+
+    /*!
+     * Get a list of available converter priorities for a given source and target format.
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param direction interleave or deinterleave
+     * \return a vector of priorities or an empty vector if none found
+     */
+    static std::vector<ConverterRegistry::FunctionPriority> listPriorities(const std::string &sourceFormat, const std::string &targetFormat, const Direction direction);
+
+    /*!
+     * Get a converter between a source and target format with the highest available priority.
+     * \throws runtime_error when the conversion does not exist
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param direction interleave or deinterleave
+     * \return a conversion function pointer
+     */
+    static ChannelConverterFunction getFunction(const std::string &sourceFormat, const std::string &targetFormat, const Direction direction);
+
+    /*!
+     * Get a converter between a source and target format with a given priority.
+     * \throws runtime_error when the conversion does not exist
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param direction interleave or deinterleave
+     * \param priority the FunctionPriority of the converter
+     * \return a conversion function pointer
+     */
+    static ChannelConverterFunction getFunction(const std::string &sourceFormat, const std::string &targetFormat, const Direction direction, const ConverterRegistry::FunctionPriority &priority);
+  };
+
+}
@@ -0,0 +1,102 @@
+///
+/// \file SoapySDR/ConverterMixer.hpp
+///
+/// Format conversion fused with a frequency shift.
+///
+/// \copyright
+/// SPDX-License-Identifier: BSL-1.0
+///
+
+#pragma once
+#include <SoapySDR/Config.hpp>
+#include <SoapySDR/ConverterPlan.hpp>
+#include <string>
+#include <cstddef>
+
+namespace SoapySDR
+{
+  /*!
+   * ConverterMixer class. A mixer converts a complex stream and multiplies it
+   * by the output of a numerically controlled oscillator (NCO), which shifts
+   * the spectrum by the oscillator frequency, in a single pass over memory.
+   *
+   * The mixing happens in CF32: the source is converted to CF32 chunk by chunk,
+   * mixed while the chunk is in L1 cache, and converted on to the target format.
+   * CS16 to CF32 uses a kernel that converts and mixes in the same registers.
+   * The oscillator advances a vector of phasors by complex rotation and
+   * resynchronizes them to a double precision phase accumulator on every chunk,
+   * so the phase stays continuous across calls without drift.
+   *
+   * A mixer holds the oscillator state and is not thread safe;
+   * use one mixer per stream.
+   */
+  class SOAPY_SDR_API ConverterMixer
+  {
+  public:
+
+    //! Create an empty mixer, isValid() returns false
+    ConverterMixer(void);
+
+    /*!
+     * Create a mixer between two complex formats.
+     * \throws runtime_error when either format is not complex
+     * or when CF32 is unreachable from the source or the target is unreachable from CF32
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param frequency the shift in cycles per sample, between -0.5 and 0.5
+     * \param scaler the scale factor applied when converting from the source format
+     */
+    ConverterMixer(const std::string &sourceFormat, const std::string &targetFormat, const double frequency, const double scaler = 1.0);
+
+    //! Does this mixer hold resolved converters?
+    bool isValid(void) const;
+
+    /*!
+     * Convert and mix a buffer, advancing the oscillator by numElems samples.
+     * \param srcBuff the input buffer in the source format
+     * \param dstBuff the output buffer in the target format
+     * \param numElems the number of elements to convert
+     */
+    void execute(const void *srcBuff, void *dstBuff, const size_t numElems);
+
+    //! Set the shift in cycles per sample, the phase is kept
+    void setFrequency(const double frequency);
+
+    //! Get the shift in cycles per sample
+    double getFrequency(void) const;
+
+    //! Set the oscillator phase in cycles, wrapped to [0, 1)
+    void setPhase(const double phase);
+
+    //! Get the oscillator phase in cycles, in [0, 1)
+    double getPhase(void) const;
+
+    //! Get the source format markup string
+    const std::string &getSourceFormat(void) const;
+
+    //! Get the target format markup string
+    const std::string &getTargetFormat(void) const;
+
+    //! Get the scale factor applied when converting from the source format
+    double getScaler(void) const;
+
+    /*!
+     * A typedef for the mixing kernels.
+     * The parameters are (input buffer, CF32 output buffer, number of elements,
+     * scale factor for integer input, start phase in cycles, frequency in cycles per sample).
+     */
+    typedef void (*MixFunction)(const void *, float *, const size_t, const float, const double, const double);
+
+  private:
+    std::string _sourceFormat;
+    std::string _targetFormat;
+    ConverterPlan _inPlan;
+    ConverterPlan _outPlan;
+    MixFunction _mix;
+    float _factor;
+    double _frequency;
+    double _phase;
+    double _scaler;
+  };
+
+}
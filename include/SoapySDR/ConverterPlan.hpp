@@ -0,0 +1,228 @@
+///
+/// \file SoapySDR/ConverterPlan.hpp
+///
+/// Pre-resolved conversions between stream formats.
+///
+/// \copyright
+/// SPDX-License-Identifier: BSL-1.0
+///
+
+#pragma once
+#include <SoapySDR/Config.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+
+namespace SoapySDR
+{
+  /*!
+   * Signal statistics accumulated by ConverterPlan::execute().
+   * Values are measured on the CF32 or F32 side of the conversion including the scaler,
+   * so integer full scale is 1.0 with a unit scaler.
+   * Real formats count as complex samples with a zero Q component.
+   * The counters accumulate over calls until reset().
+   */
+  struct SOAPY_SDR_API ConverterStats
+  {
+    //! Create zeroed statistics
+    ConverterStats(void);
+
+    //! Zero all counters
+    void reset(void);
+
+    //! Number of elements accumulated
+    size_t numElems;
+
+    //! Number of elements with a component at or beyond the clip level of the integer format
+    size_t numClipped;
+
+    //! Largest absolute value of any component
+    double peak;
+
+    //! Sum of the I components
+    double sumI;
+
+    //! Sum of the Q components
+    double sumQ;
+
+    //! Sum of the sample powers I*I + Q*Q
+    double sumPower;
+
+    //! Get the root mean square magnitude
+    double rms(void) const;
+
+    //! Get the DC offset of the I components
+    double meanI(void) const;
+
+    //! Get the DC offset of the Q components
+    double meanQ(void) const;
+  };
+
+  /*!
+   * ConverterPlan class. A plan resolves a conversion in the ConverterRegistry once
+   * and caches the selected function, its priority, the element sizes, and the scaler.
+   *
+   * Executing a plan calls the cached function directly:
+   * there are no registry lookups, no string operations, and no allocations,
+   * which makes plans suitable for per-packet conversion in streaming loops.
+   * A plan is immutable once created and may be executed from multiple threads.
+   *
+   * When no converter is registered for the source and target pair,
+   * the plan chains converters along ConverterRegistry::findPath().
+   * A chain runs chunk by chunk through small scratch buffers on the stack,
+   * so it needs no full-size intermediate buffer.
+   */
+  class SOAPY_SDR_API ConverterPlan
+  {
+  public:
+
+    //! Create an empty plan, isValid() returns false
+    ConverterPlan(void);
+
+    /*!
+     * Create a plan for the selected priority converter (see ConverterRegistry::getSelectedPriority()),
+     * or for the cheapest chain of converters when there is no direct one.
+     * \throws runtime_error when the target format is unreachable
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param scaler the scale factor passed to the converter on every execution
+     */
+    ConverterPlan(const std::string &sourceFormat, const std::string &targetFormat, const double scaler = 1.0);
+
+    /*!
+     * Create a plan for a converter with a given priority.
+     * \throws runtime_error when the conversion does not exist
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param priority the FunctionPriority of the converter
+     * \param scaler the scale factor passed to the converter on every execution
+     */
+    ConverterPlan(const std::string &sourceFormat, const std::string &targetFormat, const ConverterRegistry::FunctionPriority &priority, const double scaler = 1.0);
+
+    //! Does this plan hold a resolved converter?
+    bool isValid(void) const;
+
+    /*!
+     * Convert a buffer with the resolved converter.
+     * \param srcBuff the input buffer in the source format
+     * \param dstBuff the output buffer in the target format
+     * \param numElems the number of elements to convert
+     */
+    void execute(const void *srcBuff, void *dstBuff, const size_t numElems) const;
+
+    /*!
+     * Convert a buffer and accumulate signal statistics in the same pass.
+     * Each chunk of the conversion is measured while it is in L1 cache:
+     * the output when the target is CF32 or F32, the scaled input when the source is,
+     * and otherwise the output converted back to CF32 or F32.
+     * A component is clipped at the largest positive code of the integer format
+     * on the other side of the conversion, or at 1.0 when there is no integer format.
+     * The first call sets up the measurement, so plans that never measure do not pay for it.
+     * \throws runtime_error when the target format cannot be converted to CF32 or F32
+     * \param srcBuff the input buffer in the source format
+     * \param dstBuff the output buffer in the target format
+     * \param numElems the number of elements to convert
+     * \param [inout] stats the statistics to accumulate into
+     */
+    void execute(const void *srcBuff, void *dstBuff, const size_t numElems, ConverterStats &stats) const;
+
+    /*!
+     * Convert a large buffer on multiple threads.
+     * The buffer is split into cache-sized chunks (256 KiB of input plus output)
+     * which are converted concurrently on a worker pool shared by all plans.
+     * Buffers under 1 MiB of input plus output are converted on the calling thread,
+     * where the cost of waking workers would outweigh the gain.
+     * \param srcBuff the input buffer in the source format
+     * \param dstBuff the output buffer in the target format
+     * \param numElems the number of elements to convert
+     * \param numThreads the maximum number of threads including the caller, 0 for one per CPU, which is also the limit
+     */
+    void executeParallel(const void *srcBuff, void *dstBuff, const size_t numElems, const size_t numThreads = 0) const;
+
+    /*!
+     * Convert several buffers of the same length, such as the channels of a stream.
+     * Bindings use it to convert a list of arrays in one call into the library.
+     * \param srcBuffs an array of input buffers in the source format
+     * \param dstBuffs an array of output buffers in the target format
+     * \param numBuffs the number of buffers in each array
+     * \param numElems the number of elements to convert in each buffer
+     */
+    void executeBatch(const void * const *srcBuffs, void * const *dstBuffs, const size_t numBuffs, const size_t numElems) const;
+
+    //! Get the source format markup string
+    const std::string &getSourceFormat(void) const;
+
+    //! Get the target format markup string
+    const std::string &getTargetFormat(void) const;
+
+    //! Get the priority of the resolved converter, the lowest priority along a chain
+    ConverterRegistry::FunctionPriority getPriority(void) const;
+
+    //! Get the resolved converter function, or nullptr for a chain
+    ConverterRegistry::ConverterFunction getFunction(void) const;
+
+    /*!
+     * Can the plan convert a buffer in place, with dstBuff equal to srcBuff?
+     * A direct plan follows ConverterRegistry::supportsInPlace(),
+     * a chain supports it whenever the target element is no larger than the source element,
+     * since its hops pass through scratch buffers.
+     * In-place parallel execution of a narrowing plan runs on the calling thread.
+     */
+    bool supportsInPlace(void) const;
+
+    //! Get the formats along the conversion including the source and target
+    std::vector<std::string> getPath(void) const;
+
+    //! Get the scale factor applied on every execution
+    double getScaler(void) const;
+
+    //! Get the size of a source element in bytes
+    size_t getSourceSize(void) const;
+
+    //! Get the size of a target element in bytes
+    size_t getTargetSize(void) const;
+
+  private:
+    struct Hop
+    {
+      std::string targetFormat;
+      ConverterRegistry::ConverterFunction function;
+      double scaler;
+      size_t targetSize;
+    };
+
+    void executeChain(const void *srcBuff, void *dstBuff, const size_t numElems) const;
+
+    //how execute() with statistics measures the conversion, resolved on its first call
+    struct StatsSetup
+    {
+      StatsSetup(void);
+      //a copy or an assigned plan resolves its own setup
+      StatsSetup(const StatsSetup &);
+      StatsSetup &operator=(const StatsSetup &);
+      std::unique_ptr<std::once_flag> once;
+      std::shared_ptr<ConverterPlan> plan;
+      int side;
+      size_t depth;
+      float clipLevel;
+    };
+
+    void prepareStats(void) const;
+
+    std::vector<Hop> _hops;
+    size_t _chunkElems;
+    mutable StatsSetup _stats;
+    std::string _sourceFormat;
+    std::string _targetFormat;
+    ConverterRegistry::FunctionPriority _priority;
+    ConverterRegistry::ConverterFunction _function;
+    double _scaler;
+    size_t _sourceSize;
+    size_t _targetSize;
+    bool _inPlace;
+  };
+
+}
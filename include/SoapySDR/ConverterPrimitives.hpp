@@ -10,6 +10,8 @@
 
 #pragma once
 #include <stdint.h>
+#include <cmath> //lrint
+#include <cstring> //memcpy
 
 namespace SoapySDR
 {
@@ -51,6 +53,38 @@ inline float S8toF32(int8_t from){
   return float(from) / S8_FULL_SCALE;
 }
 
+// type conversion: double <> signed integers
+
+inline int32_t F64toS32(double from){
+  return int32_t(from * S32_FULL_SCALE);
+}
+inline double S32toF64(int32_t from){
+  return double(from) / S32_FULL_SCALE;
+}
+
+inline int16_t F64toS16(double from){
+  return int16_t(from * S16_FULL_SCALE);
+}
+inline double S16toF64(int16_t from){
+  return double(from) / S16_FULL_SCALE;
+}
+
+inline int8_t F64toS8(double from){
+  return int8_t(from * S8_FULL_SCALE);
+}
+inline double S8toF64(int8_t from){
+  return double(from) / S8_FULL_SCALE;
+}
+
+// precision conversion: double <> float
+
+inline float F64toF32(double from){
+  return float(from);
+}
+inline double F32toF64(float from){
+  return double(from);
+}
+
 
 // type conversion: offset binary <> two's complement (signed) integers
 
@@ -94,6 +128,13 @@ inline int16_t S8toS16(int8_t from){
   return int16_t(from << 8);
 }
 
+inline int8_t S32toS8(int32_t from){
+  return S16toS8(S32toS16(from));
+}
+inline int32_t S8toS32(int8_t from){
+  return S16toS32(S8toS16(from));
+}
+
 // compound conversions
 
 // float <> unsigned (type and size)
@@ -119,6 +160,29 @@ inline float U8toF32(uint8_t from){
   return S8toF32(U8toS8(from));
 }
 
+// double <> unsigned (type and size)
+
+inline uint32_t F64toU32(double from){
+  return S32toU32(F64toS32(from));
+}
+inline double U32toF64(uint32_t from){
+  return S32toF64(U32toS32(from));
+}
+
+inline uint16_t F64toU16(double from){
+  return S16toU16(F64toS16(from));
+}
+inline double U16toF64(uint16_t from){
+  return S16toF64(U16toS16(from));
+}
+
+inline uint8_t F64toU8(double from){
+  return S8toU8(F64toS8(from));
+}
+inline double U8toF64(uint8_t from){
+  return S8toF64(U8toS8(from));
+}
+
 // signed <> unsigned (type and size)
 
 inline uint16_t S32toU16(int32_t from){
@@ -149,5 +213,153 @@ inline int8_t U16toS8(uint16_t from){
   return S16toS8(U16toS16(from));
 }
 
+inline int16_t U32toS16(uint32_t from){
+  return S32toS16(U32toS32(from));
+}
+inline uint32_t S16toU32(int16_t from){
+  return S32toU32(S16toS32(from));
+}
+
+inline int8_t U32toS8(uint32_t from){
+  return S32toS8(U32toS32(from));
+}
+inline uint32_t S8toU32(int8_t from){
+  return S32toU32(S8toS32(from));
+}
+
+// unsigned <> unsigned (size)
+
+inline uint16_t U32toU16(uint32_t from){
+  return S16toU16(S32toS16(U32toS32(from)));
+}
+inline uint32_t U16toU32(uint16_t from){
+  return S32toU32(S16toS32(U16toS16(from)));
+}
+
+inline uint8_t U32toU8(uint32_t from){
+  return S8toU8(S32toS8(U32toS32(from)));
+}
+inline uint32_t U8toU32(uint8_t from){
+  return S32toU32(S8toS32(U8toS8(from)));
+}
+
+inline uint8_t U16toU8(uint16_t from){
+  return S8toU8(S16toS8(U16toS16(from)));
+}
+inline uint16_t U8toU16(uint8_t from){
+  return S16toU16(S8toS16(U8toS8(from)));
+}
+
+// precision conversion: float <> IEEE 754 half precision, stored as uint16_t
+
+inline float F16toF32(uint16_t from){
+  const uint32_t sign = uint32_t(from & 0x8000) << 16;
+  const uint32_t exponent = (from >> 10) & 0x1f;
+  const uint32_t mantissa = from & 0x3ff;
+  uint32_t bits = 0;
+  if (exponent == 0x1f) bits = sign | 0x7f800000 | ((mantissa != 0)?(0x400000 | (mantissa << 13)):0); //inf, quiet nan
+  else if (exponent != 0) bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+  else
+  {
+    const float subnormal = float(mantissa) * 5.9604644775390625e-8f; //2^-24
+    std::memcpy(&bits, &subnormal, sizeof(bits));
+    bits |= sign;
+  }
+  float to;
+  std::memcpy(&to, &bits, sizeof(to));
+  return to;
+}
+
+//rounds to nearest even, like the F16C conversion instructions
+inline uint16_t F32toF16(float from){
+  uint32_t bits;
+  std::memcpy(&bits, &from, sizeof(bits));
+  const uint32_t sign = (bits >> 16) & 0x8000;
+  const uint32_t magnitude = bits & 0x7fffffff;
+  if (magnitude >= 0x7f800000) return uint16_t(sign | 0x7c00 | ((magnitude > 0x7f800000)?(0x200 | ((magnitude >> 13) & 0x3ff)):0));
+  if (magnitude >= 0x477ff000) return uint16_t(sign | 0x7c00); //rounds past 65504
+  if (magnitude < 0x38800000) //half precision subnormal or zero
+  {
+    if (magnitude <= 0x33000000) return uint16_t(sign);
+    const uint32_t shift = 126 - (magnitude >> 23);
+    const uint32_t mantissa = (magnitude & 0x7fffff) | 0x800000;
+    const uint32_t rest = mantissa & ((1u << shift) - 1);
+    const uint32_t half = 1u << (shift - 1);
+    uint32_t to = mantissa >> shift;
+    if (rest > half or (rest == half and (to & 1))) to++;
+    return uint16_t(sign | to);
+  }
+  uint32_t to = (magnitude - 0x38000000) >> 13;
+  const uint32_t rest = magnitude & 0x1fff;
+  if (rest > 0x1000 or (rest == 0x1000 and (to & 1))) to++;
+  return uint16_t(sign | to);
+}
+
+/*!
+ * Saturating primitives for converting floating point values to integer formats.
+ * They round to the nearest integer (ties to even in the default rounding mode)
+ * and clamp values outside of full scale to the integer limits,
+ * where the primitives above truncate and wrap around.
+ * \param from the value to convert from
+ * \return the converted value
+ */
+
+// type conversion: float > signed integers, saturating
+
+inline int32_t F32toS32Sat(float from){
+  const float x = from * S32_FULL_SCALE;
+  if (x >= 2147483648.0f) return INT32_MAX;
+  if (x < -2147483648.0f) return INT32_MIN;
+  return int32_t(std::lrint(x));
+}
+
+inline int16_t F32toS16Sat(float from){
+  const float x = from * S16_FULL_SCALE;
+  return int16_t(std::lrint((x > 32767.0f)?32767.0f:((x < -32768.0f)?-32768.0f:x)));
+}
+
+inline int8_t F32toS8Sat(float from){
+  const float x = from * S8_FULL_SCALE;
+  return int8_t(std::lrint((x > 127.0f)?127.0f:((x < -128.0f)?-128.0f:x)));
+}
+
+// type conversion: double > signed integers, saturating
+
+inline int32_t F64toS32Sat(double from){
+  const double x = from * S32_FULL_SCALE;
+  return int32_t(std::lrint((x > 2147483647.0)?2147483647.0:((x < -2147483648.0)?-2147483648.0:x)));
+}
+
+inline int16_t F64toS16Sat(double from){
+  const double x = from * S16_FULL_SCALE;
+  return int16_t(std::lrint((x > 32767.0)?32767.0:((x < -32768.0)?-32768.0:x)));
+}
+
+inline int8_t F64toS8Sat(double from){
+  const double x = from * S8_FULL_SCALE;
+  return int8_t(std::lrint((x > 127.0)?127.0:((x < -128.0)?-128.0:x)));
+}
+
+// type conversion: float/double > unsigned integers, saturating
+
+inline uint32_t F32toU32Sat(float from){
+  return S32toU32(F32toS32Sat(from));
+}
+inline uint16_t F32toU16Sat(float from){
+  return S16toU16(F32toS16Sat(from));
+}
+inline uint8_t F32toU8Sat(float from){
+  return S8toU8(F32toS8Sat(from));
+}
+
+inline uint32_t F64toU32Sat(double from){
+  return S32toU32(F64toS32Sat(from));
+}
+inline uint16_t F64toU16Sat(double from){
+  return S16toU16(F64toS16Sat(from));
+}
+inline uint8_t F64toU8Sat(double from){
+  return S8toU8(F64toS8Sat(from));
+}
 
 }
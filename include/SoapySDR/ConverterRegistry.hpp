@@ -38,6 +38,9 @@ namespace SoapySDR
      * A converter function copies and optionally converts an input buffer of one format into an
      * output buffer of another format.
      * The parameters are (input pointer, output pointer, number of elements, optional scalar)
+     *
+     * The input and output buffers must not overlap, unless the function is registered
+     * as in-place capable (see supportsInPlace()), in which case the output pointer may equal the input pointer.
      */
     typedef void (*ConverterFunction)(const void *, void *, const size_t, const double);
 
@@ -50,6 +53,29 @@ namespace SoapySDR
       CUSTOM = 5            //!< Custom user re-implementation. Max priority.
     };
 
+    /*!
+     * CPUFeature: instruction set extensions that a ConverterFunction may require.
+     * The values are bit flags which can be combined into a feature mask.
+     *
+     * When several functions are registered for the same source, target, and priority,
+     * the most capable one that the host supports is selected. The features are ranked
+     * from the least to the most capable as SSE2, SSSE3, SSE4.1, AVX, F16C, FMA, AVX2,
+     * AVX-512F, AVX-512BW, which differs from the order of the bit values.
+     * A function ranks by the most capable feature in its mask. On a tie,
+     * the mask with more features wins, e.g. CPU_AVX2 | CPU_FMA over CPU_AVX2 alone.
+     */
+    enum CPUFeature{
+      CPU_SSE2 = (1 << 0),        //!< x86 SSE2
+      CPU_SSSE3 = (1 << 1),       //!< x86 SSSE3
+      CPU_SSE41 = (1 << 2),       //!< x86 SSE4.1
+      CPU_AVX = (1 << 3),         //!< x86 AVX
+      CPU_AVX2 = (1 << 4),        //!< x86 AVX2
+      CPU_FMA = (1 << 5),         //!< x86 FMA3
+      CPU_F16C = (1 << 6),        //!< x86 half-precision conversions
+      CPU_AVX512F = (1 << 7),     //!< x86 AVX-512 foundation
+      CPU_AVX512BW = (1 << 8)     //!< x86 AVX-512 byte and word instructions
+    };
+
     /*!
      * TargetFormatConverterPriority: a map of possible conversion functions for a given Priority.
      * Maintained by the registry.
@@ -79,6 +105,33 @@ namespace SoapySDR
      * \param converter function to register
      */
     ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converter);
+
+    /*!
+     * Class constructor. Registers a ConverterFunction with a
+     * given source format, target format, priority, and CPU requirements.
+     *
+     * The converter is silently skipped when the host CPU lacks any of the required features.
+     * When another converter with the same source/target/priority exists,
+     * the one with the most capable feature mask is kept, see CPUFeature.
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param priority the FunctionPriority of the converter to register
+     * \param converter function to register
+     * \param cpuFeatures a mask of CPUFeature flags required to run the converter
+     */
+    ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converter, const int cpuFeatures);
+
+    /*!
+     * Class constructor. Registers a ConverterFunction with a
+     * given source format, target format, priority, CPU requirements, and in-place capability.
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param priority the FunctionPriority of the converter to register
+     * \param converter function to register
+     * \param cpuFeatures a mask of CPUFeature flags required to run the converter
+     * \param inPlace true when the converter gives the same result with the output pointer equal to the input pointer
+     */
+    ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converter, const int cpuFeatures, const bool inPlace);
     
     /*!
      * Get a list of existing target formats to which we can convert the specified source from.
@@ -107,7 +160,8 @@ namespace SoapySDR
     static std::vector<FunctionPriority> listPriorities(const std::string &sourceFormat, const std::string &targetFormat);
     
     /*!
-     * Get a converter between a source and target format with the highest available priority.
+     * Get a converter between a source and target format with the highest available priority,
+     * or with the fastest priority on this host once autotune() has run.
      * \throws invalid_argument when the conversion does not exist and logs error
      * \param sourceFormat the source format markup string
      * \param targetFormat the target format markup string
@@ -121,11 +175,129 @@ namespace SoapySDR
 
     static ConverterFunction getFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority);
 
+    /*!
+     * Can the selected converter (see getSelectedPriority()) convert a buffer in place,
+     * with the output pointer equal to the input pointer?
+     * Every converter of the library whose target element is no larger than its source element,
+     * such as CF32 to CS16 or CS16 to CU16, supports in-place conversion,
+     * and so do the library's saturating converters.
+     * Other converters only support it when registered with the inPlace flag.
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \return true when the conversion may be done in place, false otherwise or when it does not exist
+     */
+    static bool supportsInPlace(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Can the converter with a given priority convert a buffer in place?
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param priority the FunctionPriority of the converter
+     * \return true when the conversion may be done in place
+     */
+    static bool supportsInPlace(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority);
+
+    /*!
+     * Get the CPU features that the converter with a given priority requires,
+     * as passed when it was registered.
+     * \throws runtime_error when the conversion priority does not exist
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param priority the FunctionPriority of the converter
+     * \return a mask of CPUFeature flags, 0 for a converter without requirements
+     */
+    static int getRequiredCPUFeatures(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority);
+
+    /*!
+     * Register a rounding and saturating variant of a float to integer converter.
+     * Saturating converters round to the nearest integer and clamp out of range values
+     * to the limits of the target format, where the converters from getFunction()
+     * truncate and wrap around.
+     * Converters needing CPU features that the host lacks are skipped,
+     * and the one with the most capable feature mask is kept, see CPUFeature.
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param priority the FunctionPriority of the converter to register
+     * \param converter function to register
+     * \param cpuFeatures a mask of CPUFeature flags required to run the converter
+     */
+    static void registerSaturatingFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converter, const int cpuFeatures = 0);
+
+    /*!
+     * Get a rounding and saturating converter with the highest available priority.
+     * These exist from the floating point formats to the integer formats,
+     * and are meant for transmit paths where a slightly hot signal must clip rather than wrap.
+     * \throws runtime_error when there is no saturating converter for the formats
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \return a conversion function pointer
+     */
+    static ConverterFunction getSaturatingFunction(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Get a rounding and saturating converter with a given priority.
+     * \throws runtime_error when there is no saturating converter for the formats and priority
+     */
+    static ConverterFunction getSaturatingFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority);
+
     /*!
      * Get a list of known source formats in the registry.
      */
     static std::vector<std::string> listAvailableSourceFormats(void);
 
+    /*!
+     * Find the cheapest chain of registered converters from a source to a target format.
+     * Each hop uses its selected priority converter (see getSelectedPriority()) and costs the bytes it moves per element,
+     * weighted so that higher priority converters are preferred.
+     * Intermediate formats must have a known element size (see formatToSize()).
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \return the formats along the chain including the source and target,
+     * or an empty vector when the target is unreachable
+     */
+    static std::vector<std::string> findPath(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Get the mask of CPUFeature flags supported by the host.
+     * The features are detected once and cached for the lifetime of the process.
+     * The SOAPY_SDR_CPU_FEATURES environment variable, when set to an integer mask,
+     * restricts the detected features, which is useful to test the fallback converters.
+     * \return a mask of CPUFeature flags
+     */
+    static int getCPUFeatures(void);
+
+    /*!
+     * Get the priority that getFunction(sourceFormat, targetFormat) selects:
+     * the autotuned priority when one applies (see autotune()), otherwise the highest priority.
+     * \throws runtime_error when the conversion does not exist
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \return the selected priority
+     */
+    static FunctionPriority getSelectedPriority(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Select the fastest priority of each source/target pair on this host.
+     * The highest priority is not always the fastest, so every registered priority
+     * of pairs with more than one converter is timed at representative buffer sizes.
+     *
+     * A tuned choice only applies while the same priorities are registered for its pair,
+     * so a converter registered afterwards, such as a module's CUSTOM converter,
+     * is selected by the usual highest priority rule.
+     *
+     * The choices are persisted in a cache file keyed by the CPU model and features,
+     * and later processes load the cache instead of benchmarking again.
+     * The cache records the priorities of each pair, and is tuned again
+     * when the registered converters no longer match it.
+     * The cache is stored in the directory named by SOAPY_SDR_CONVERTER_CACHE,
+     * or in the user cache directory (XDG_CACHE_HOME, ~/.cache, or LOCALAPPDATA).
+     * Setting the SOAPY_SDR_CONVERTER_AUTOTUNE environment variable to 1
+     * runs autotune() when the converters are first loaded.
+     *
+     * \param force benchmark again even when a cache file exists
+     */
+    static void autotune(const bool force = false);
+
   };
   
 }
@@ -37,11 +37,56 @@ typedef enum
     SOAPY_SDR_CONVERTER_CUSTOM = 5
 } SoapySDRConverterFunctionPriority;
 
+/*!
+ * Instruction set extensions that a converter function may require.
+ * The values are bit flags which can be combined into a feature mask.
+ */
+typedef enum
+{
+    SOAPY_SDR_CPU_SSE2 = (1 << 0),      //!< x86 SSE2
+    SOAPY_SDR_CPU_SSSE3 = (1 << 1),     //!< x86 SSSE3
+    SOAPY_SDR_CPU_SSE41 = (1 << 2),     //!< x86 SSE4.1
+    SOAPY_SDR_CPU_AVX = (1 << 3),       //!< x86 AVX
+    SOAPY_SDR_CPU_AVX2 = (1 << 4),      //!< x86 AVX2
+    SOAPY_SDR_CPU_FMA = (1 << 5),       //!< x86 FMA3
+    SOAPY_SDR_CPU_F16C = (1 << 6),      //!< x86 half-precision conversions
+    SOAPY_SDR_CPU_AVX512F = (1 << 7),   //!< x86 AVX-512 foundation
+    SOAPY_SDR_CPU_AVX512BW = (1 << 8)   //!< x86 AVX-512 byte and word instructions
+} SoapySDRConverterCPUFeature;
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
+//! Forward declaration of converter plan handle
+typedef struct SoapySDRConverterPlan SoapySDRConverterPlan;
+
+//! Forward declaration of converter mixer handle
+typedef struct SoapySDRConverterMixer SoapySDRConverterMixer;
+
+//! Signal statistics accumulated by SoapySDRConverterPlan_executeWithStats()
+typedef struct
+{
+    //! Number of elements accumulated
+    size_t numElems;
+
+    //! Number of elements with a component at or beyond the clip level
+    size_t numClipped;
+
+    //! Largest absolute value of any component
+    double peak;
+
+    //! Sum of the I components
+    double sumI;
+
+    //! Sum of the Q components
+    double sumQ;
+
+    //! Sum of the sample powers I*I + Q*Q
+    double sumPower;
+} SoapySDRConverterStats;
+
 /*!
  * Get a list of existing target formats to which we can convert the specified source from.
  * \param sourceFormat the source format markup string
@@ -83,6 +128,26 @@ SOAPY_SDR_API SoapySDRConverterFunction SoapySDRConverter_getFunction(const char
  */
 SOAPY_SDR_API SoapySDRConverterFunction SoapySDRConverter_getFunctionWithPriority(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionPriority priority);
 
+/*!
+ * Can the selected converter (see SoapySDR::ConverterRegistry::getSelectedPriority())
+ * between a source and target format convert in place,
+ * with the output buffer equal to the input buffer?
+ * \param sourceFormat the source format markup string
+ * \param targetFormat the target format markup string
+ * \return true when in-place conversion is supported
+ */
+SOAPY_SDR_API bool SoapySDRConverter_supportsInPlace(const char *sourceFormat, const char *targetFormat);
+
+/*!
+ * Get a rounding and saturating converter between a floating point source
+ * and an integer target format with the highest available priority.
+ * Out of range values clip to the integer limits instead of wrapping around.
+ * \param sourceFormat the source format markup string
+ * \param targetFormat the target format markup string
+ * \return a conversion function pointer or nullptr if none are found
+ */
+SOAPY_SDR_API SoapySDRConverterFunction SoapySDRConverter_getSaturatingFunction(const char *sourceFormat, const char *targetFormat);
+
 /*!
  * Get a list of known source formats in the registry.
  * \param [out] length the number of known source formats
@@ -90,6 +155,196 @@ SOAPY_SDR_API SoapySDRConverterFunction SoapySDRConverter_getFunctionWithPriorit
  */
 SOAPY_SDR_API char **SoapySDRConverter_listAvailableSourceFormats(size_t *length);
 
+/*!
+ * Get the mask of CPU features supported by the host.
+ * \return a mask of SoapySDRConverterCPUFeature flags
+ */
+SOAPY_SDR_API int SoapySDRConverter_getCPUFeatures(void);
+
+/*!
+ * Create a plan for the highest priority converter between a source and target format.
+ * When no direct converter is registered, the plan chains converters through intermediate formats.
+ * The plan caches the resolved function, element sizes, and scaler,
+ * so that executing it performs no lookups or allocations.
+ * For every call to make, there should be a matched call to unmake.
+ * \param sourceFormat the source format markup string
+ * \param targetFormat the target format markup string
+ * \param scaler the scale factor passed to the converter on every execution
+ * \return a new plan handle or nullptr if the target format is unreachable
+ */
+SOAPY_SDR_API SoapySDRConverterPlan *SoapySDRConverterPlan_make(const char *sourceFormat, const char *targetFormat, const double scaler);
+
+/*!
+ * Create a plan for a converter between a source and target format with a given priority.
+ * \param sourceFormat the source format markup string
+ * \param targetFormat the target format markup string
+ * \param priority the priority of the converter
+ * \param scaler the scale factor passed to the converter on every execution
+ * \return a new plan handle or nullptr if the conversion is not registered
+ */
+SOAPY_SDR_API SoapySDRConverterPlan *SoapySDRConverterPlan_makeWithPriority(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionPriority priority, const double scaler);
+
+/*!
+ * Release a converter plan handle.
+ * \param plan a pointer to a plan handle
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRConverterPlan_unmake(SoapySDRConverterPlan *plan);
+
+/*!
+ * Convert a buffer with the resolved converter of a plan.
+ * \param plan a pointer to a plan handle
+ * \param srcBuff the input buffer in the source format
+ * \param dstBuff the output buffer in the target format
+ * \param numElems the number of elements to convert
+ */
+SOAPY_SDR_API void SoapySDRConverterPlan_execute(const SoapySDRConverterPlan *plan, const void *srcBuff, void *dstBuff, const size_t numElems);
+
+/*!
+ * Convert a large buffer on multiple threads with the resolved converter of a plan.
+ * Buffers below the parallel threshold are converted on the calling thread.
+ * \param plan a pointer to a plan handle
+ * \param srcBuff the input buffer in the source format
+ * \param dstBuff the output buffer in the target format
+ * \param numElems the number of elements to convert
+ * \param numThreads the maximum number of threads including the caller, 0 for one per CPU, which is also the limit
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRConverterPlan_executeParallel(const SoapySDRConverterPlan *plan, const void *srcBuff, void *dstBuff, const size_t numElems, const size_t numThreads);
+
+/*!
+ * Get the priority of the converter resolved by a plan.
+ * \param plan a pointer to a plan handle
+ * \return the converter priority
+ */
+SOAPY_SDR_API SoapySDRConverterFunctionPriority SoapySDRConverterPlan_getPriority(const SoapySDRConverterPlan *plan);
+
+/*!
+ * Get the converter function resolved by a plan.
+ * \param plan a pointer to a plan handle
+ * \return a conversion function pointer, or nullptr for a chained plan
+ */
+SOAPY_SDR_API SoapySDRConverterFunction SoapySDRConverterPlan_getFunction(const SoapySDRConverterPlan *plan);
+
+/*!
+ * Get the size of a source element of a plan.
+ * \param plan a pointer to a plan handle
+ * \return the size of a source element in bytes
+ */
+SOAPY_SDR_API size_t SoapySDRConverterPlan_getSourceSize(const SoapySDRConverterPlan *plan);
+
+/*!
+ * Get the size of a target element of a plan.
+ * \param plan a pointer to a plan handle
+ * \return the size of a target element in bytes
+ */
+SOAPY_SDR_API size_t SoapySDRConverterPlan_getTargetSize(const SoapySDRConverterPlan *plan);
+
+/*!
+ * Can the plan convert in place, with the output buffer equal to the input buffer?
+ * \param plan a pointer to a plan handle
+ * \return true when in-place conversion is supported
+ */
+SOAPY_SDR_API bool SoapySDRConverterPlan_supportsInPlace(const SoapySDRConverterPlan *plan);
+
+/*!
+ * Convert several buffers of the same length with the resolved converter of a plan.
+ * \param plan a pointer to a plan handle
+ * \param srcBuffs an array of input buffers in the source format
+ * \param dstBuffs an array of output buffers in the target format
+ * \param numBuffs the number of buffers in each array
+ * \param numElems the number of elements to convert in each buffer
+ */
+SOAPY_SDR_API void SoapySDRConverterPlan_executeBatch(const SoapySDRConverterPlan *plan, const void * const *srcBuffs, void * const *dstBuffs, const size_t numBuffs, const size_t numElems);
+
+/*!
+ * Convert a buffer and accumulate signal statistics in the same pass.
+ * The statistics accumulate over calls, zero the structure to start over.
+ * \param plan a pointer to a plan handle
+ * \param srcBuff the input buffer in the source format
+ * \param dstBuff the output buffer in the target format
+ * \param numElems the number of elements to convert
+ * \param [inout] stats the statistics to accumulate into
+ * \return 0 for success or error code when the conversion has no statistics
+ */
+SOAPY_SDR_API int SoapySDRConverterPlan_executeWithStats(const SoapySDRConverterPlan *plan, const void *srcBuff, void *dstBuff, const size_t numElems, SoapySDRConverterStats *stats);
+
+/*!
+ * Get the source format of a plan.
+ * \param plan a pointer to a plan handle
+ * \return the source format markup string, owned by the plan
+ */
+SOAPY_SDR_API const char *SoapySDRConverterPlan_getSourceFormat(const SoapySDRConverterPlan *plan);
+
+/*!
+ * Get the target format of a plan.
+ * \param plan a pointer to a plan handle
+ * \return the target format markup string, owned by the plan
+ */
+SOAPY_SDR_API const char *SoapySDRConverterPlan_getTargetFormat(const SoapySDRConverterPlan *plan);
+
+/*!
+ * Get the scale factor applied by a plan on every execution.
+ * \param plan a pointer to a plan handle
+ * \return the scale factor
+ */
+SOAPY_SDR_API double SoapySDRConverterPlan_getScaler(const SoapySDRConverterPlan *plan);
+
+/*!
+ * Create a mixer that converts between two complex formats and shifts the frequency.
+ * For every call to make, there should be a matched call to unmake.
+ * \param sourceFormat the source format markup string
+ * \param targetFormat the target format markup string
+ * \param frequency the shift in cycles per sample, between -0.5 and 0.5
+ * \param scaler the scale factor applied when converting from the source format
+ * \return a new mixer handle or nullptr if the conversion is not possible
+ */
+SOAPY_SDR_API SoapySDRConverterMixer *SoapySDRConverterMixer_make(const char *sourceFormat, const char *targetFormat, const double frequency, const double scaler);
+
+/*!
+ * Release a converter mixer handle.
+ * \param mixer a pointer to a mixer handle
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRConverterMixer_unmake(SoapySDRConverterMixer *mixer);
+
+/*!
+ * Convert and mix a buffer, advancing the oscillator by numElems samples.
+ * \param mixer a pointer to a mixer handle
+ * \param srcBuff the input buffer in the source format
+ * \param dstBuff the output buffer in the target format
+ * \param numElems the number of elements to convert
+ */
+SOAPY_SDR_API void SoapySDRConverterMixer_execute(SoapySDRConverterMixer *mixer, const void *srcBuff, void *dstBuff, const size_t numElems);
+
+/*!
+ * Set the shift of a mixer, the phase is kept.
+ * \param mixer a pointer to a mixer handle
+ * \param frequency the shift in cycles per sample
+ */
+SOAPY_SDR_API void SoapySDRConverterMixer_setFrequency(SoapySDRConverterMixer *mixer, const double frequency);
+
+/*!
+ * Get the shift of a mixer.
+ * \param mixer a pointer to a mixer handle
+ * \return the shift in cycles per sample
+ */
+SOAPY_SDR_API double SoapySDRConverterMixer_getFrequency(const SoapySDRConverterMixer *mixer);
+
+/*!
+ * Set the oscillator phase of a mixer.
+ * \param mixer a pointer to a mixer handle
+ * \param phase the phase in cycles, wrapped to [0, 1)
+ */
+SOAPY_SDR_API void SoapySDRConverterMixer_setPhase(SoapySDRConverterMixer *mixer, const double phase);
+
+/*!
+ * Get the oscillator phase of a mixer.
+ * \param mixer a pointer to a mixer handle
+ * \return the phase in cycles, in [0, 1)
+ */
+SOAPY_SDR_API double SoapySDRConverterMixer_getPhase(const SoapySDRConverterMixer *mixer);
+
 #ifdef __cplusplus
 }
 #endif
@@ -467,6 +467,10 @@ SOAPY_SDR_API int SoapySDRDevice_readStreamStatus(SoapySDRDevice *device,
  * This is the number of times the user can call acquire()
  * on a stream without making subsequent calls to release().
  * A return value of 0 means that direct access is not supported.
+ * When the driver does not provide direct access, streams created with
+ * SoapySDRDevice_setupStream() emulate it with a pool of buffers
+ * that are filled by readStream() and drained by writeStream().
+ * The pool is allocated by the first direct access call on the stream.
  *
  * \param device a pointer to a device instance
  * \param stream the opaque pointer to a stream handle
@@ -18,6 +18,7 @@
 #include <vector>
 #include <string>
 #include <complex>
+#include <memory>
 #include <cstddef> //size_t
 
 namespace SoapySDR
@@ -26,6 +27,9 @@ namespace SoapySDR
 //! Forward declaration of stream handle for type safety
 class Stream;
 
+//! Forward declaration of emulated direct access buffers, see Device::enableDirectAccessEmulation()
+class DirectAccessEmulation;
+
 /*!
  * Abstraction for an SDR transceiver device - configuration and streaming.
  */
@@ -415,11 +419,44 @@ public:
      * Direct buffer access API
      ******************************************************************/
 
+    /*!
+     * Emulate the direct buffer access API on a stream.
+     * When a driver does not implement direct buffer access,
+     * the default implementations of the calls below serve the stream
+     * from a pool of aligned buffers: acquireReadBuffer() fills a buffer
+     * with readStream(), and releaseWriteBuffer() drains it with writeStream().
+     * Drivers with native direct buffer access are not affected.
+     *
+     * The emulation needs the stream layout, which only the driver knows.
+     * The C API enables it on the first direct access call to a stream.
+     * C++, Python and C# callers enable it after setupStream().
+     *
+     * The emulation lasts as long as the returned handle.
+     * Release the handle before closeStream(): a driver may give
+     * a later stream the same address, which must not inherit the buffers.
+     *
+     * \throws invalid_argument when the format has no known element size
+     * \param stream the opaque pointer to a stream handle
+     * \param direction the channel direction RX or TX
+     * \param format the stream format passed to setupStream()
+     * \param numChans the number of channels of the stream
+     * \param numBuffs the number of buffers in the pool
+     * \return a handle that keeps the emulation enabled
+     */
+    std::shared_ptr<DirectAccessEmulation> enableDirectAccessEmulation(
+        Stream *stream,
+        const int direction,
+        const std::string &format,
+        const size_t numChans,
+        const size_t numBuffs = 4);
+
     /*!
      * How many direct access buffers can the stream provide?
      * This is the number of times the user can call acquire()
      * on a stream without making subsequent calls to release().
      * A return value of 0 means that direct access is not supported.
+     * The default implementation returns the number of emulated buffers,
+     * see enableDirectAccessEmulation().
      *
      * \param stream the opaque pointer to a stream handle
      * \return the number of direct access buffers or 0
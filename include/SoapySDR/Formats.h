@@ -18,6 +18,9 @@
 //! Complex 32-bit floats (complex float)
 #define SOAPY_SDR_CF32 "CF32"
 
+//! Complex 16-bit IEEE 754 half precision floats
+#define SOAPY_SDR_CF16 "CF16"
+
 //! Complex signed 32-bit integers (complex int32)
 #define SOAPY_SDR_CS32 "CS32"
 
@@ -54,6 +57,9 @@
 //! Real 32-bit floats (float)
 #define SOAPY_SDR_F32 "F32"
 
+//! Real 16-bit IEEE 754 half precision floats
+#define SOAPY_SDR_F16 "F16"
+
 //! Real signed 32-bit integers (int32)
 #define SOAPY_SDR_S32 "S32"
 
@@ -72,6 +78,31 @@
 //! Real unsigned 8-bit integers (uint8)
 #define SOAPY_SDR_U8 "U8"
 
+/*!
+ * Big-endian wire formats.
+ * These formats carry the same samples as their native counterparts
+ * with the bytes of every component in network byte order,
+ * as found in VITA-49 style packets and some recording formats.
+ */
+
+//! Complex 32-bit floats, big-endian (complex float)
+#define SOAPY_SDR_CF32_BE "CF32_BE"
+
+//! Complex signed 32-bit integers, big-endian (complex int32)
+#define SOAPY_SDR_CS32_BE "CS32_BE"
+
+//! Complex signed 16-bit integers, big-endian (complex int16)
+#define SOAPY_SDR_CS16_BE "CS16_BE"
+
+//! Real 32-bit floats, big-endian (float)
+#define SOAPY_SDR_F32_BE "F32_BE"
+
+//! Real signed 32-bit integers, big-endian (int32)
+#define SOAPY_SDR_S32_BE "S32_BE"
+
+//! Real signed 16-bit integers, big-endian (int16)
+#define SOAPY_SDR_S16_BE "S16_BE"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
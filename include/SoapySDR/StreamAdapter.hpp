@@ -0,0 +1,159 @@
+///
+/// \file SoapySDR/StreamAdapter.hpp
+///
+/// Stream any registered format from any device.
+///
+/// \copyright
+/// SPDX-License-Identifier: BSL-1.0
+///
+
+#pragma once
+#include <SoapySDR/Config.hpp>
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/ConverterPlan.hpp>
+#include <SoapySDR/Buffer.hpp>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+namespace SoapySDR
+{
+  /*!
+   * StreamAdapter class. An adapter sets up a stream in the device's native format
+   * (see Device::getNativeStreamFormat()) and presents it in any format that the
+   * ConverterRegistry can reach, so applications need no conversion pass of their own.
+   *
+   * The conversion takes the fastest path the driver allows:
+   *  - When the requested format is the native format, calls pass through to the driver
+   *    with no copies.
+   *  - When the driver provides direct buffer access, samples are converted straight
+   *    out of the driver's receive buffers or into its transmit buffers.
+   *  - Otherwise the driver reads or writes through a scratch buffer of one MTU per channel.
+   *
+   * Conversions are scaled so that the device's full scale (the fullScale value returned by
+   * getNativeStreamFormat()) maps to the full scale of the requested format: 1.0 for floats.
+   * When the ConverterRegistry cannot reach the requested format, the adapter lets the driver
+   * convert if it lists the format in Device::getStreamFormats().
+   *
+   * Like a stream, an adapter is not thread safe.
+   */
+  class SOAPY_SDR_API StreamAdapter
+  {
+  public:
+
+    /*!
+     * Set up a stream on the device, see Device::setupStream().
+     * \throws runtime_error when the format is unreachable or the driver fails to set up the stream
+     * \param device a pointer to a device instance, which must outlive the adapter
+     * \param direction the channel direction (`SOAPY_SDR_RX` or `SOAPY_SDR_TX`)
+     * \param format the format of the buffers passed to read() and write()
+     * \param channels a list of channels or empty for automatic
+     * \param args stream args passed to the driver
+     */
+    StreamAdapter(
+      Device *device,
+      const int direction,
+      const std::string &format,
+      const std::vector<size_t> &channels = std::vector<size_t>(),
+      const Kwargs &args = Kwargs());
+
+    //! Close the native stream
+    ~StreamAdapter(void);
+
+    //! Get the device of the stream
+    Device *getDevice(void) const;
+
+    //! Get the driver's stream handle
+    Stream *getNativeStream(void) const;
+
+    //! Get the format of the buffers passed to read() and write()
+    const std::string &getFormat(void) const;
+
+    //! Get the format of the driver's stream
+    const std::string &getNativeFormat(void) const;
+
+    //! Does the adapter forward buffers to the driver without conversion?
+    bool isPassthrough(void) const;
+
+    //! Does the adapter convert through the driver's direct access buffers?
+    bool usesDirectAccess(void) const;
+
+    //! Get the scale factor applied by the conversion
+    double getScaler(void) const;
+
+    //! Get the maximum number of elements per read() or write() call, see Device::getStreamMTU()
+    size_t getMTU(void) const;
+
+    //! Activate the stream, see Device::activateStream()
+    int activate(const int flags = 0, const long long timeNs = 0, const size_t numElems = 0);
+
+    //! Deactivate the stream, see Device::deactivateStream()
+    int deactivate(const int flags = 0, const long long timeNs = 0);
+
+    /*!
+     * Read and convert elements, see Device::readStream().
+     * When a direct access buffer holds more elements than requested,
+     * the remainder is returned by the next call with SOAPY_SDR_MORE_FRAGMENTS set.
+     * \param buffs an array of buffers in the requested format, one per channel
+     * \param numElems the number of elements in each buffer
+     * \param [out] flags flag indicators about the result
+     * \param [out] timeNs the timestamp of the first element in nanoseconds
+     * \param timeoutUs the timeout in microseconds
+     * \return the number of elements read per buffer or error code
+     */
+    int read(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs = 100000);
+
+    /*!
+     * Convert and write elements, see Device::writeStream().
+     * SOAPY_SDR_END_BURST is only passed on with the last element of the buffers.
+     * \param buffs an array of buffers in the requested format, one per channel
+     * \param numElems the number of elements in each buffer
+     * \param [inout] flags input flags and output flags
+     * \param timeNs the timestamp of the first element in nanoseconds
+     * \param timeoutUs the timeout in microseconds
+     * \return the number of elements written per buffer or error code
+     */
+    int write(const void * const *buffs, const size_t numElems, int &flags, const long long timeNs = 0, const long timeoutUs = 100000);
+
+    //! Read back stream status, see Device::readStreamStatus()
+    int readStatus(size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs = 100000);
+
+  private:
+    //non-copyable: the adapter owns the native stream
+    StreamAdapter(const StreamAdapter &);
+    StreamAdapter &operator=(const StreamAdapter &);
+
+    int readDirect(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs);
+    int writeDirect(const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long timeoutUs);
+    void releaseHeld(void);
+
+    Device *_device;
+    Stream *_stream;
+    int _direction;
+    std::string _format;
+    std::string _nativeFormat;
+    ConverterPlan _plan;
+    bool _passthrough;
+    bool _direct;
+    size_t _channel;
+    size_t _numChans;
+    size_t _mtu;
+    double _rate;
+
+    //one MTU of native elements per channel when converting through readStream() and writeStream()
+    std::vector<Buffer> _scratch;
+    std::vector<void *> _scratchPtrs;
+    std::vector<const void *> _inPtrs;
+    std::vector<void *> _outPtrs;
+
+    //the partially consumed direct access receive buffer
+    bool _held;
+    size_t _heldHandle;
+    std::vector<const void *> _heldBuffs;
+    size_t _heldOffset;
+    size_t _heldElems;
+    int _heldFlags;
+    long long _heldTimeNs;
+  };
+
+}
@@ -0,0 +1,275 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Buffer.hpp>
+#include <SoapySDR/Logger.hpp>
+#include <stdexcept>
+#include <new>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdint>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+/***********************************************************************
+ * Allocation header
+ *
+ * The header sits right before the aligned memory, so that
+ * freeBuffer() and the Buffer getters only need the data pointer.
+ **********************************************************************/
+struct BufferHeader
+{
+  void *base; //start of the allocation
+  size_t mapSize; //size of the page mapping, 0 for heap memory
+  size_t size;
+  bool hugePages;
+  bool locked;
+  int numaNode;
+};
+
+static BufferHeader *getHeader(void *data)
+{
+  return reinterpret_cast<BufferHeader *>(data) - 1;
+}
+
+static size_t roundUp(const size_t value, const size_t multiple)
+{
+  return ((value + multiple - 1) / multiple) * multiple;
+}
+
+#ifdef __linux__
+
+//the usual huge page size, mappings with MAP_HUGETLB are a multiple of it
+static const size_t HUGE_PAGE_SIZE = size_t(2) << 20;
+
+//prefer the node rather than bind to it, so that the allocation still succeeds when the node is full
+static const int MPOL_PREFERRED_MODE = 1;
+
+static bool bindNumaNode(void *addr, const size_t size, const int node)
+{
+#ifdef SYS_mbind
+  const size_t bitsPerLong = 8*sizeof(unsigned long);
+  std::vector<unsigned long> mask(size_t(node)/bitsPerLong + 1, 0);
+  mask[size_t(node)/bitsPerLong] = 1UL << (size_t(node) % bitsPerLong);
+  return syscall(SYS_mbind, addr, size, MPOL_PREFERRED_MODE, mask.data(), mask.size()*bitsPerLong + 1, 0) == 0;
+#else
+  return false;
+#endif
+}
+
+/*!
+ * Map anonymous pages for a buffer with huge pages or NUMA placement.
+ * Explicit huge pages come from the pool reserved in /proc/sys/vm/nr_hugepages,
+ * otherwise the mapping asks for transparent huge pages.
+ * The node is bound before the pages are touched, so they are allocated on it.
+ */
+static char *mapPages(const size_t size, const SoapySDR::BufferArgs &args, BufferHeader &header)
+{
+  void *addr = MAP_FAILED;
+  if (args.hugePages)
+    {
+      header.mapSize = roundUp(size, HUGE_PAGE_SIZE);
+      addr = mmap(nullptr, header.mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      header.hugePages = addr != MAP_FAILED;
+      if (addr == MAP_FAILED) SoapySDR::logf(SOAPY_SDR_DEBUG, "allocBuffer() no huge pages reserved, using transparent huge pages");
+    }
+  if (addr == MAP_FAILED)
+    {
+      header.mapSize = roundUp(size, size_t(sysconf(_SC_PAGESIZE)));
+      addr = mmap(nullptr, header.mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (addr == MAP_FAILED) return nullptr;
+#ifdef MADV_HUGEPAGE
+      if (args.hugePages) madvise(addr, header.mapSize, MADV_HUGEPAGE);
+#endif
+    }
+
+  if (args.numaNode >= 0)
+    {
+      if (bindNumaNode(addr, header.mapSize, args.numaNode)) header.numaNode = args.numaNode;
+      else SoapySDR::logf(SOAPY_SDR_DEBUG, "allocBuffer() cannot bind to NUMA node %d", args.numaNode);
+    }
+  return (char *)addr;
+}
+
+#endif //__linux__
+
+static bool lockPages(void *addr, const size_t size)
+{
+#ifdef _WIN32
+  (void)addr;
+  (void)size;
+  return false;
+#else
+  return mlock(addr, size) == 0;
+#endif
+}
+
+/***********************************************************************
+ * Allocation
+ **********************************************************************/
+SoapySDR::BufferArgs::BufferArgs(void):
+  alignment(SOAPY_SDR_BUFFER_ALIGNMENT),
+  hugePages(false),
+  lockMemory(false),
+  numaNode(-1)
+{
+  return;
+}
+
+static void *allocBuffer(const size_t size, const SoapySDR::BufferArgs &args)
+{
+  if (args.alignment == 0 or (args.alignment & (args.alignment - 1)) != 0)
+    {
+      throw std::invalid_argument("allocBuffer() alignment must be a power of two");
+    }
+  //the header before the memory needs its own alignment
+  const size_t alignment = std::max<size_t>(args.alignment, alignof(BufferHeader));
+
+  BufferHeader header = {};
+  header.numaNode = -1;
+  header.size = size;
+  const size_t total = size + sizeof(BufferHeader) + alignment;
+
+  char *base = nullptr;
+#ifdef __linux__
+  if (args.hugePages or args.numaNode >= 0) base = mapPages(total, args, header);
+#endif
+  if (base == nullptr)
+    {
+      header.mapSize = 0;
+      base = (char *)std::malloc(total);
+      if (base == nullptr) throw std::bad_alloc();
+    }
+  header.base = base;
+
+  const uintptr_t first = uintptr_t(base) + sizeof(BufferHeader);
+  void *data = (void *)roundUp(first, alignment);
+  if (args.lockMemory)
+    {
+      header.locked = lockPages(data, size);
+      if (not header.locked) SoapySDR::logf(SOAPY_SDR_DEBUG, "allocBuffer() cannot lock %d bytes", int(size));
+    }
+  *getHeader(data) = header;
+  return data;
+}
+
+static void freeBuffer(void *data)
+{
+  if (data == nullptr) return;
+  const BufferHeader header = *getHeader(data);
+#ifndef _WIN32
+  if (header.locked) munlock(data, header.size);
+  if (header.mapSize != 0)
+    {
+      munmap(header.base, header.mapSize);
+      return;
+    }
+#endif
+  std::free(header.base);
+}
+
+/***********************************************************************
+ * Buffer
+ **********************************************************************/
+SoapySDR::Buffer::Buffer(void):
+  _data(nullptr),
+  _size(0)
+{
+  return;
+}
+
+SoapySDR::Buffer::Buffer(const size_t size, const BufferArgs &args):
+  _data(allocBuffer(size, args)),
+  _size(size)
+{
+  return;
+}
+
+SoapySDR::Buffer::Buffer(Buffer &&other):
+  _data(other._data),
+  _size(other._size)
+{
+  other._data = nullptr;
+  other._size = 0;
+}
+
+SoapySDR::Buffer &SoapySDR::Buffer::operator=(Buffer &&other)
+{
+  if (this == &other) return *this;
+  freeBuffer(_data);
+  _data = other._data;
+  _size = other._size;
+  other._data = nullptr;
+  other._size = 0;
+  return *this;
+}
+
+SoapySDR::Buffer::~Buffer(void)
+{
+  freeBuffer(_data);
+}
+
+void *SoapySDR::Buffer::data(void) const
+{
+  return _data;
+}
+
+size_t SoapySDR::Buffer::size(void) const
+{
+  return _size;
+}
+
+bool SoapySDR::Buffer::usesHugePages(void) const
+{
+  return _data != nullptr and getHeader(_data)->hugePages;
+}
+
+bool SoapySDR::Buffer::isLocked(void) const
+{
+  return _data != nullptr and getHeader(_data)->locked;
+}
+
+int SoapySDR::Buffer::getNumaNode(void) const
+{
+  return (_data == nullptr)?-1:getHeader(_data)->numaNode;
+}
+
+void *SoapySDR::Buffer::release(void)
+{
+  void *data = _data;
+  _data = nullptr;
+  _size = 0;
+  return data;
+}
+
+void SoapySDR::Buffer::free(void *data)
+{
+  freeBuffer(data);
+}
+
+/***********************************************************************
+ * NUMA placement from device info
+ **********************************************************************/
+static int parseNumaNode(const SoapySDR::Kwargs &info)
+{
+  const auto it = info.find("numa_node");
+  if (it == info.end()) return -1;
+  char *end(nullptr);
+  const long node = std::strtol(it->second.c_str(), &end, 10);
+  if (end == it->second.c_str() or node < 0) return -1;
+  return int(node);
+}
+
+int SoapySDR::getNumaNode(const Device *device, const int direction, const size_t channel)
+{
+  const int node = parseNumaNode(device->getChannelInfo(direction, channel));
+  if (node >= 0) return node;
+  return parseNumaNode(device->getHardwareInfo());
+}
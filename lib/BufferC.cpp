@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "ErrorHelpers.hpp"
+
+#include <SoapySDR/Buffer.h>
+#include <SoapySDR/Buffer.hpp>
+
+extern "C" {
+
+void SoapySDRBufferArgs_init(SoapySDRBufferArgs *args)
+{
+    const SoapySDR::BufferArgs defaults;
+    args->alignment = defaults.alignment;
+    args->hugePages = defaults.hugePages;
+    args->lockMemory = defaults.lockMemory;
+    args->numaNode = defaults.numaNode;
+}
+
+void *SoapySDR_allocBuffer(const size_t size, const SoapySDRBufferArgs *args)
+{
+    __SOAPY_SDR_C_TRY
+    SoapySDR::BufferArgs argsCpp;
+    if (args != nullptr)
+    {
+        argsCpp.alignment = args->alignment;
+        argsCpp.hugePages = args->hugePages;
+        argsCpp.lockMemory = args->lockMemory;
+        argsCpp.numaNode = args->numaNode;
+    }
+    SoapySDR::Buffer buff(size, argsCpp);
+    return buff.release();
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+void SoapySDR_freeBuffer(void *buff)
+{
+    SoapySDR::Buffer::free(buff);
+}
+
+int SoapySDRDevice_getNumaNode(const SoapySDRDevice *device, const int direction, const size_t channel)
+{
+    __SOAPY_SDR_C_TRY
+    return SoapySDR::getNumaNode(reinterpret_cast<const SoapySDR::Device *>(device), direction, channel);
+    __SOAPY_SDR_C_CATCH_RET(-1);
+}
+
+}
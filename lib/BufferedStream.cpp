@@ -0,0 +1,611 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/BufferedStream.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Logger.hpp>
+#include <SoapySDR/Errors.hpp>
+#include <SoapySDR/Time.hpp>
+#include "StreamRing.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstring>
+
+//how long the background threads block in the driver before checking for shutdown
+static const long THREAD_TIMEOUT_US = 100000;
+
+//errors after which the driver will not produce more samples
+static bool isFatalStreamError(const int ret)
+{
+  return ret == SOAPY_SDR_STREAM_ERROR or ret == SOAPY_SDR_NOT_SUPPORTED;
+}
+
+//raise an atomic maximum, the consumer may reset it concurrently
+static void updateMax(std::atomic<size_t> &max, const size_t value)
+{
+  size_t current = max.load();
+  while (value > current and not max.compare_exchange_weak(current, value)) {}
+}
+
+//place the buffers near the device, unless the caller chose a NUMA node
+static SoapySDR::BufferArgs deviceBufferArgs(const SoapySDR::Device *device, const int direction,
+  const std::vector<size_t> &channels, const SoapySDR::BufferArgs &args)
+{
+  SoapySDR::BufferArgs result(args);
+  if (result.numaNode < 0) result.numaNode = SoapySDR::getNumaNode(device, direction, channels.empty()?0:channels.front());
+  return result;
+}
+
+/***********************************************************************
+ * BufferedRxStream
+ **********************************************************************/
+
+struct SoapySDR::BufferedRxStream::Impl
+{
+  Impl(Device *device, Stream *stream, const size_t channel, const size_t numChans,
+    const size_t elemSize, const size_t depth, const size_t chunkElems, const BufferArgs &args):
+    device(device),
+    stream(stream),
+    channel(channel),
+    numChans(numChans),
+    elemSize(elemSize),
+    chunkElems(chunkElems),
+    rate(0.0),
+    ring(depth, numChans, chunkElems*elemSize, args),
+    running(false),
+    offset(0),
+    highWaterMark(0),
+    numDropped(0),
+    numOverflows(0)
+  {
+    dropMemory.reserve(numChans);
+    for (size_t i = 0; i < numChans; i++)
+      {
+        dropMemory.emplace_back(chunkElems*elemSize, args);
+        dropBuffs.push_back(dropMemory.back().data());
+      }
+  }
+
+  void readerLoop(void);
+  void publish(StreamRing::Slot *slot, const int ret, const int flags, const long long timeNs);
+  void stopReader(void);
+
+  Device *device;
+  Stream *stream;
+  const size_t channel;
+  const size_t numChans;
+  const size_t elemSize;
+  const size_t chunkElems;
+  double rate;
+  StreamRing ring;
+
+  //chunks that do not fit in the ring are read here and discarded
+  std::vector<Buffer> dropMemory;
+  std::vector<void *> dropBuffs;
+
+  std::thread thread;
+  std::atomic<bool> running;
+
+  //elements of the front chunk already returned by read()
+  size_t offset;
+
+  std::atomic<size_t> highWaterMark;
+  std::atomic<unsigned long long> numDropped;
+  std::atomic<unsigned long long> numOverflows;
+};
+
+void SoapySDR::BufferedRxStream::Impl::publish(StreamRing::Slot *slot, const int ret, const int flags, const long long timeNs)
+{
+  slot->ret = ret;
+  slot->flags = flags;
+  slot->timeNs = timeNs;
+  ring.push();
+  updateMax(highWaterMark, ring.size());
+}
+
+void SoapySDR::BufferedRxStream::Impl::readerLoop(void)
+{
+  //set after discarding chunks, the overflow is queued once the ring has space
+  bool lostSamples(false);
+
+  while (running.load())
+    {
+      StreamRing::Slot *slot = ring.back();
+      if (slot != nullptr and lostSamples)
+        {
+          this->publish(slot, SOAPY_SDR_OVERFLOW, 0, 0);
+          lostSamples = false;
+          continue;
+        }
+
+      int flags(0);
+      long long timeNs(0);
+      int ret(0);
+      try
+        {
+          void * const *buffs = (slot == nullptr)?dropBuffs.data():slot->buffs.data();
+          ret = device->readStream(stream, buffs, chunkElems, flags, timeNs, THREAD_TIMEOUT_US);
+        }
+      catch (const std::exception &ex)
+        {
+          SoapySDR::logf(SOAPY_SDR_ERROR, "BufferedRxStream: readStream threw %s", ex.what());
+          ret = SOAPY_SDR_STREAM_ERROR;
+        }
+
+      if (ret == SOAPY_SDR_TIMEOUT) continue;
+      if (ret == SOAPY_SDR_OVERFLOW) numOverflows++;
+
+      if (slot == nullptr)
+        {
+          if (ret > 0) numDropped += size_t(ret);
+          if (ret > 0 or ret == SOAPY_SDR_OVERFLOW) lostSamples = true;
+          if (not isFatalStreamError(ret)) continue;
+
+          //the application must still see why the stream ended
+          while (slot == nullptr and running.load()) slot = ring.waitBack(THREAD_TIMEOUT_US);
+          if (slot == nullptr) return;
+        }
+
+      this->publish(slot, ret, flags, timeNs);
+      if (isFatalStreamError(ret)) return;
+    }
+}
+
+void SoapySDR::BufferedRxStream::Impl::stopReader(void)
+{
+  running = false;
+  if (thread.joinable()) thread.join();
+}
+
+SoapySDR::BufferedRxStream::BufferedRxStream(
+  Device *device,
+  Stream *stream,
+  const std::string &format,
+  const std::vector<size_t> &channels,
+  const size_t depth,
+  const size_t chunkElems,
+  const BufferArgs &args):
+  _impl(nullptr)
+{
+  const size_t elemSize = formatToSize(format);
+  if (elemSize == 0) throw std::runtime_error("BufferedRxStream() unknown format "+format);
+  if (depth == 0) throw std::runtime_error("BufferedRxStream() depth must be non-zero");
+
+  _impl = new Impl(
+    device, stream,
+    channels.empty()?0:channels.front(),
+    std::max<size_t>(1, channels.size()),
+    elemSize, depth,
+    (chunkElems == 0)?device->getStreamMTU(stream):chunkElems,
+    deviceBufferArgs(device, SOAPY_SDR_RX, channels, args));
+}
+
+SoapySDR::BufferedRxStream::~BufferedRxStream(void)
+{
+  _impl->stopReader();
+  delete _impl;
+}
+
+size_t SoapySDR::BufferedRxStream::getDepth(void) const
+{
+  return _impl->ring.depth();
+}
+
+size_t SoapySDR::BufferedRxStream::getChunkElems(void) const
+{
+  return _impl->chunkElems;
+}
+
+int SoapySDR::BufferedRxStream::activate(const int flags, const long long timeNs, const size_t numElems)
+{
+  _impl->stopReader();
+  _impl->ring.clear();
+  _impl->offset = 0;
+
+  //the rate gives the timestamps of fragments of a chunk
+  _impl->rate = _impl->device->getSampleRate(SOAPY_SDR_RX, _impl->channel);
+  const int ret = _impl->device->activateStream(_impl->stream, flags, timeNs, numElems);
+  if (ret != 0) return ret;
+
+  _impl->running = true;
+  _impl->thread = std::thread(&Impl::readerLoop, _impl);
+  return 0;
+}
+
+int SoapySDR::BufferedRxStream::deactivate(const int flags, const long long timeNs)
+{
+  _impl->stopReader();
+  return _impl->device->deactivateStream(_impl->stream, flags, timeNs);
+}
+
+int SoapySDR::BufferedRxStream::read(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+{
+  StreamRing::Slot *slot = _impl->ring.waitFront(timeoutUs);
+  if (slot == nullptr) return SOAPY_SDR_TIMEOUT;
+
+  flags = slot->flags;
+  timeNs = slot->timeNs;
+  if (slot->ret <= 0)
+    {
+      const int ret = slot->ret;
+      _impl->ring.pop();
+      return ret;
+    }
+
+  const size_t offset = _impl->offset;
+  const size_t elemSize = _impl->elemSize;
+  const size_t n = std::min(numElems, size_t(slot->ret)-offset);
+  for (size_t i = 0; i < _impl->numChans; i++)
+    {
+      std::memcpy(buffs[i], (const char *)slot->buffs[i] + offset*elemSize, n*elemSize);
+    }
+
+  if (offset != 0 and _impl->rate > 0.0) timeNs += ticksToTimeNs((long long)offset, _impl->rate);
+  _impl->offset += n;
+  if (_impl->offset < size_t(slot->ret))
+    {
+      flags = (flags & ~SOAPY_SDR_END_BURST) | SOAPY_SDR_MORE_FRAGMENTS;
+    }
+  else
+    {
+      _impl->offset = 0;
+      _impl->ring.pop();
+    }
+  return int(n);
+}
+
+size_t SoapySDR::BufferedRxStream::getNumBuffered(void) const
+{
+  return _impl->ring.size();
+}
+
+size_t SoapySDR::BufferedRxStream::getHighWaterMark(void) const
+{
+  return _impl->highWaterMark.load();
+}
+
+unsigned long long SoapySDR::BufferedRxStream::getNumDropped(void) const
+{
+  return _impl->numDropped.load();
+}
+
+unsigned long long SoapySDR::BufferedRxStream::getNumOverflows(void) const
+{
+  return _impl->numOverflows.load();
+}
+
+void SoapySDR::BufferedRxStream::resetCounters(void)
+{
+  _impl->highWaterMark = 0;
+  _impl->numDropped = 0;
+  _impl->numOverflows = 0;
+}
+
+/***********************************************************************
+ * BufferedTxStream
+ **********************************************************************/
+
+//how often a busy feeder reads the stream status, it also does when idle
+static const std::chrono::milliseconds STATUS_INTERVAL(10);
+
+struct SoapySDR::BufferedTxStream::Impl
+{
+  Impl(Device *device, Stream *stream, const size_t numChans, const size_t elemSize,
+    const size_t depth, const size_t chunkElems, const size_t prefill, const BufferArgs &args):
+    device(device),
+    stream(stream),
+    numChans(numChans),
+    elemSize(elemSize),
+    chunkElems(chunkElems),
+    prefill(std::min(prefill, depth)),
+    ring(depth, numChans, chunkElems*elemSize, args),
+    running(false),
+    activated(false),
+    flushing(false),
+    error(0),
+    activateFlags(0),
+    activateTimeNs(0),
+    activateNumElems(0),
+    statusSupported(true),
+    ptrs(numChans),
+    numUnderflows(0),
+    numLate(0)
+  {
+    return;
+  }
+
+  void feederLoop(void);
+  bool prefilled(void);
+  int writeChunk(const StreamRing::Slot &slot);
+  void readStatus(void);
+  void setError(const int ret);
+  void stopFeeder(void);
+
+  Device *device;
+  Stream *stream;
+  const size_t numChans;
+  const size_t elemSize;
+  const size_t chunkElems;
+  const size_t prefill;
+  StreamRing ring;
+
+  std::thread thread;
+  std::atomic<bool> running;
+  std::atomic<bool> activated;
+  std::atomic<bool> flushing; //activate without the full prefill
+  std::atomic<int> error;
+
+  //the deferred activateStream() arguments
+  int activateFlags;
+  long long activateTimeNs;
+  size_t activateNumElems;
+
+  //feeder thread state
+  bool statusSupported;
+  std::vector<const void *> ptrs;
+
+  std::atomic<unsigned long long> numUnderflows;
+  std::atomic<unsigned long long> numLate;
+};
+
+bool SoapySDR::BufferedTxStream::Impl::prefilled(void)
+{
+  const size_t n = ring.size();
+  if (n >= prefill or (flushing.load() and n != 0)) return true;
+
+  //a burst shorter than the prefill is sent without waiting for more
+  for (size_t i = 0; i < n; i++)
+    {
+      if ((ring.at(i)->flags & SOAPY_SDR_END_BURST) != 0) return true;
+    }
+  return false;
+}
+
+int SoapySDR::BufferedTxStream::Impl::writeChunk(const StreamRing::Slot &slot)
+{
+  const size_t numElems = size_t(slot.ret);
+  size_t offset(0);
+  while (running.load())
+    {
+      for (size_t i = 0; i < numChans; i++)
+        {
+          ptrs[i] = (const char *)slot.buffs[i] + offset*elemSize;
+        }
+
+      //the timestamp belongs to the first element of the chunk
+      int flags = (offset == 0)?slot.flags:(slot.flags & ~SOAPY_SDR_HAS_TIME);
+      const int ret = device->writeStream(stream, ptrs.data(), numElems-offset, flags, slot.timeNs, THREAD_TIMEOUT_US);
+      if (ret == SOAPY_SDR_TIMEOUT) continue;
+      if (ret == SOAPY_SDR_UNDERFLOW)
+        {
+          numUnderflows++;
+          continue;
+        }
+      if (ret == SOAPY_SDR_TIME_ERROR)
+        {
+          //the chunk cannot be sent at its time anymore
+          numLate++;
+          return 0;
+        }
+      if (ret < 0)
+        {
+          if (isFatalStreamError(ret)) return ret;
+          SoapySDR::logf(SOAPY_SDR_WARNING, "BufferedTxStream: writeStream dropped a chunk, %s", SoapySDR::errToStr(ret));
+          return 0;
+        }
+      offset += size_t(ret);
+      if (offset >= numElems) return 0;
+    }
+  return 0;
+}
+
+void SoapySDR::BufferedTxStream::Impl::readStatus(void)
+{
+  while (statusSupported)
+    {
+      size_t chanMask(0);
+      int flags(0);
+      long long timeNs(0);
+      const int ret = device->readStreamStatus(stream, chanMask, flags, timeNs, 0);
+      if (ret == SOAPY_SDR_UNDERFLOW) numUnderflows++;
+      else if (ret == SOAPY_SDR_TIME_ERROR) numLate++;
+      else if (ret == SOAPY_SDR_NOT_SUPPORTED) statusSupported = false;
+      else break;
+    }
+}
+
+//the feeder stops on an error, so a flush() waiting for the ring returns at once
+void SoapySDR::BufferedTxStream::Impl::setError(const int ret)
+{
+  error = ret;
+  ring.notify();
+}
+
+void SoapySDR::BufferedTxStream::Impl::feederLoop(void)
+{
+  try
+    {
+      if (not activated.load())
+        {
+          //start the stream with the prefill already queued
+          while (running.load() and not ring.waitUntil([this]{return this->prefilled();}, THREAD_TIMEOUT_US)) {}
+          if (not running.load()) return;
+          const int ret = device->activateStream(stream, activateFlags, activateTimeNs, activateNumElems);
+          if (ret != 0)
+            {
+              SoapySDR::logf(SOAPY_SDR_ERROR, "BufferedTxStream: activateStream failed, %s", SoapySDR::errToStr(ret));
+              this->setError(ret);
+              return;
+            }
+          activated = true;
+        }
+
+      auto lastStatus = std::chrono::steady_clock::now();
+      while (running.load())
+        {
+          StreamRing::Slot *slot = ring.waitFront(THREAD_TIMEOUT_US);
+          if (slot != nullptr)
+            {
+              const int ret = this->writeChunk(*slot);
+              if (ret != 0)
+                {
+                  SoapySDR::logf(SOAPY_SDR_ERROR, "BufferedTxStream: writeStream failed, %s", SoapySDR::errToStr(ret));
+                  this->setError(ret);
+                  return;
+                }
+              ring.pop();
+            }
+
+          const auto now = std::chrono::steady_clock::now();
+          if (slot == nullptr or now > lastStatus + STATUS_INTERVAL)
+            {
+              lastStatus = now;
+              this->readStatus();
+            }
+        }
+    }
+  catch (const std::exception &ex)
+    {
+      SoapySDR::logf(SOAPY_SDR_ERROR, "BufferedTxStream: %s", ex.what());
+      this->setError(SOAPY_SDR_STREAM_ERROR);
+    }
+}
+
+void SoapySDR::BufferedTxStream::Impl::stopFeeder(void)
+{
+  running = false;
+  if (thread.joinable()) thread.join();
+}
+
+SoapySDR::BufferedTxStream::BufferedTxStream(
+  Device *device,
+  Stream *stream,
+  const std::string &format,
+  const std::vector<size_t> &channels,
+  const size_t depth,
+  const size_t chunkElems,
+  const size_t prefill,
+  const BufferArgs &args):
+  _impl(nullptr)
+{
+  const size_t elemSize = formatToSize(format);
+  if (elemSize == 0) throw std::runtime_error("BufferedTxStream() unknown format "+format);
+  if (depth == 0) throw std::runtime_error("BufferedTxStream() depth must be non-zero");
+
+  _impl = new Impl(
+    device, stream,
+    std::max<size_t>(1, channels.size()),
+    elemSize, depth,
+    (chunkElems == 0)?device->getStreamMTU(stream):chunkElems,
+    prefill,
+    deviceBufferArgs(device, SOAPY_SDR_TX, channels, args));
+}
+
+SoapySDR::BufferedTxStream::~BufferedTxStream(void)
+{
+  _impl->stopFeeder();
+  delete _impl;
+}
+
+size_t SoapySDR::BufferedTxStream::getDepth(void) const
+{
+  return _impl->ring.depth();
+}
+
+size_t SoapySDR::BufferedTxStream::getChunkElems(void) const
+{
+  return _impl->chunkElems;
+}
+
+size_t SoapySDR::BufferedTxStream::getPrefill(void) const
+{
+  return _impl->prefill;
+}
+
+int SoapySDR::BufferedTxStream::activate(const int flags, const long long timeNs, const size_t numElems)
+{
+  if (_impl->running.load()) return 0;
+  _impl->error = 0;
+  _impl->flushing = false;
+  _impl->activateFlags = flags;
+  _impl->activateTimeNs = timeNs;
+  _impl->activateNumElems = numElems;
+
+  if (_impl->prefill == 0)
+    {
+      const int ret = _impl->device->activateStream(_impl->stream, flags, timeNs, numElems);
+      if (ret != 0) return ret;
+      _impl->activated = true;
+    }
+
+  _impl->running = true;
+  _impl->thread = std::thread(&Impl::feederLoop, _impl);
+  return 0;
+}
+
+int SoapySDR::BufferedTxStream::deactivate(const int flags, const long long timeNs)
+{
+  _impl->stopFeeder();
+  _impl->ring.clear();
+  if (not _impl->activated.load()) return 0;
+  _impl->activated = false;
+  return _impl->device->deactivateStream(_impl->stream, flags, timeNs);
+}
+
+int SoapySDR::BufferedTxStream::write(const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long timeoutUs)
+{
+  const int error = _impl->error.load();
+  if (error != 0) return error;
+
+  StreamRing::Slot *slot = _impl->ring.waitBack(timeoutUs);
+  if (slot == nullptr) return SOAPY_SDR_TIMEOUT;
+
+  const size_t elemSize = _impl->elemSize;
+  const size_t n = std::min(numElems, _impl->chunkElems);
+  for (size_t i = 0; i < _impl->numChans; i++)
+    {
+      std::memcpy(slot->buffs[i], buffs[i], n*elemSize);
+    }
+
+  if (n < numElems) flags &= ~SOAPY_SDR_END_BURST;
+  slot->ret = int(n);
+  slot->flags = flags;
+  slot->timeNs = timeNs;
+  _impl->ring.push();
+  return int(n);
+}
+
+int SoapySDR::BufferedTxStream::flush(const long timeoutUs)
+{
+  //the feeder waiting for the prefill starts with what is queued
+  _impl->flushing = true;
+  _impl->ring.notify();
+
+  const bool done = _impl->ring.waitUntil([this]{return _impl->ring.size() == 0 or _impl->error.load() != 0;}, timeoutUs);
+  const int error = _impl->error.load();
+  if (error != 0) return error;
+  return done?0:SOAPY_SDR_TIMEOUT;
+}
+
+size_t SoapySDR::BufferedTxStream::getNumBuffered(void) const
+{
+  return _impl->ring.size();
+}
+
+unsigned long long SoapySDR::BufferedTxStream::getNumUnderflows(void) const
+{
+  return _impl->numUnderflows.load();
+}
+
+unsigned long long SoapySDR::BufferedTxStream::getNumLate(void) const
+{
+  return _impl->numLate.load();
+}
+
+void SoapySDR::BufferedTxStream::resetCounters(void)
+{
+  _impl->numUnderflows = 0;
+  _impl->numLate = 0;
+}
@@ -0,0 +1,244 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// Converters for the big-endian wire formats (CS16_BE, CS32_BE, CF32_BE and their real forms).
+// The byte swap is fused into the conversion, so reading a big-endian packet
+// into any native format is a single pass over the buffer.
+// The SSSE3 kernels swap with a byte shuffle; the swap-and-convert kernels
+// between CS16_BE and CF32 are bit-exact with the generic converters.
+
+#include "SampleConversion.hpp"
+#include "VectorizedHelpers.hpp"
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <cstring> //memcpy
+
+typedef SoapySDR::ConverterRegistry CR;
+
+// ********************************
+// Byte order
+
+//reverse the bytes of a big-endian value, or pass it through on a big-endian host
+template <typename T>
+static inline T swapBytes(const T in)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  return in;
+#else
+  uint8_t b[sizeof(T)], r[sizeof(T)];
+  std::memcpy(b, &in, sizeof(T));
+  for (size_t k = 0; k < sizeof(T); k++) r[k] = b[sizeof(T)-1-k];
+  T out;
+  std::memcpy(&out, r, sizeof(T));
+  return out;
+#endif
+}
+
+SOAPY_SDR_FORMAT_TYPE(FormatS32BE, int32_t, SOAPY_SDR_S32_BE, SOAPY_SDR_CS32_BE)
+SOAPY_SDR_FORMAT_TYPE(FormatS16BE, int16_t, SOAPY_SDR_S16_BE, SOAPY_SDR_CS16_BE)
+SOAPY_SDR_FORMAT_TYPE(FormatF32BE, float, SOAPY_SDR_F32_BE, SOAPY_SDR_CF32_BE)
+
+typedef FormatList<FormatS32BE, FormatS16BE, FormatF32BE> BigEndianFormats;
+
+// ********************************
+// Generic converters
+
+template <typename From, typename To, size_t elemDepth>
+static void genericFromBigEndian(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const From*)srcBuff;
+  auto *dst = (To*)dstBuff;
+
+  if (scaler == 1.0)
+    {
+      for (size_t i = 0; i < n; i++) dst[i] = Sample<From, To>::convert(swapBytes(src[i]));
+    }
+  else
+    {
+      for (size_t i = 0; i < n; i++) dst[i] = scaleSample<From, To>(swapBytes(src[i]), scaler);
+    }
+}
+
+template <typename From, typename To, size_t elemDepth>
+static void genericToBigEndian(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const From*)srcBuff;
+  auto *dst = (To*)dstBuff;
+
+  if (scaler == 1.0)
+    {
+      for (size_t i = 0; i < n; i++) dst[i] = swapBytes(Sample<From, To>::convert(src[i]));
+    }
+  else
+    {
+      for (size_t i = 0; i < n; i++) dst[i] = swapBytes(scaleSample<From, To>(src[i], scaler));
+    }
+}
+
+template <size_t elemDepth>
+static void genericF32toS16BigEndianSat(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < n; i++) dst[i] = swapBytes(SoapySDR::F32toS16Sat(src[i] * scaler));
+}
+
+#if defined(SOAPY_SDR_CONVERTERS_X86) && !(defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+
+// ********************************
+// SSSE3 kernels
+
+//shuffle control that reverses the bytes of each lane of the given width
+template <size_t width>
+SOAPY_SDR_TARGET("ssse3")
+static inline __m128i swapMask(void)
+{
+  return (width == 2)?
+    _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14):
+    _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+}
+
+// X_BE <> X, scaled conversions use the generic converters
+template <typename T, size_t elemDepth, bool toBigEndian>
+SOAPY_SDR_TARGET("ssse3")
+static void ssse3Swap(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  if (scaler != 1.0)
+    {
+      if (toBigEndian) return genericToBigEndian<T, T, elemDepth>(srcBuff, dstBuff, numElems, scaler);
+      return genericFromBigEndian<T, T, elemDepth>(srcBuff, dstBuff, numElems, scaler);
+    }
+
+  const size_t n = numElems*elemDepth;
+  auto *src = (const T*)srcBuff;
+  auto *dst = (T*)dstBuff;
+  const __m128i mask = swapMask<sizeof(T)>();
+  const size_t step = 16/sizeof(T);
+  size_t i = 0;
+  for (; i+step <= n; i += step)
+    {
+      _mm_storeu_si128((__m128i*)(dst+i), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src+i)), mask));
+    }
+  for (; i < n; i++) dst[i] = swapBytes(src[i]);
+}
+
+SOAPY_SDR_TARGET("ssse3")
+static void ssse3CS16BEtoCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, 1.0/SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      const __m128i mask = swapMask<2>();
+      for (; i+8 <= n; i += 8)
+        {
+          sse2S16toF32x8(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src+i)), mask), factor, dst+i);
+        }
+    }
+  for (; i < n; i++) dst[i] = SoapySDR::S16toF32(swapBytes(src[i])) * scaler;
+}
+
+SOAPY_SDR_TARGET("ssse3")
+static void ssse3CF32toCS16BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      const __m128i mask = swapMask<2>();
+      for (; i+8 <= n; i += 8)
+        {
+          _mm_storeu_si128((__m128i*)(dst+i), _mm_shuffle_epi8(sse2F32toS16x8(src+i, factor), mask));
+        }
+    }
+  for (; i < n; i++) dst[i] = swapBytes(SoapySDR::F32toS16(src[i] * scaler));
+}
+
+SOAPY_SDR_TARGET("ssse3")
+static void ssse3CF32toCS16BESat(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      const __m128i mask = swapMask<2>();
+      for (; i+8 <= n; i += 8)
+        {
+          _mm_storeu_si128((__m128i*)(dst+i), _mm_shuffle_epi8(sse2F32toS16Satx8(src+i, factor), mask));
+        }
+    }
+  for (; i < n; i++) dst[i] = swapBytes(SoapySDR::F32toS16Sat(src[i] * scaler));
+}
+
+#define SOAPY_SDR_SSSE3_SWAP
+#endif
+
+// ********************************
+// Registration
+
+template <typename BigEndian, typename Native>
+static int registerBigEndianPair(void)
+{
+  typedef typename BigEndian::Type Wire;
+  typedef typename Native::Type Type;
+  CR(BigEndian::real(), Native::real(), CR::GENERIC, &genericFromBigEndian<Wire, Type, 1>);
+  CR(BigEndian::complex(), Native::complex(), CR::GENERIC, &genericFromBigEndian<Wire, Type, 2>);
+  CR(Native::real(), BigEndian::real(), CR::GENERIC, &genericToBigEndian<Type, Wire, 1>);
+  CR(Native::complex(), BigEndian::complex(), CR::GENERIC, &genericToBigEndian<Type, Wire, 2>);
+  return 0;
+}
+
+template <typename BigEndian, typename... Natives>
+static int registerBigEndianFormat(FormatList<Natives...>)
+{
+  const int pairs[] = {registerBigEndianPair<BigEndian, Natives>()...};
+  return int(sizeof(pairs)/sizeof(pairs[0]));
+}
+
+template <typename... BigEndians>
+static int registerBigEndianMatrix(FormatList<BigEndians...>)
+{
+  const int formats[] = {registerBigEndianFormat<BigEndians>(DefaultFormats())...};
+  return int(sizeof(formats)/sizeof(formats[0]));
+}
+
+#ifdef SOAPY_SDR_SSSE3_SWAP
+template <typename T>
+static void registerSSSE3Swap(const char *realBE, const char *complexBE, const char *real, const char *complex)
+{
+  CR(realBE, real, CR::VECTORIZED, &ssse3Swap<T, 1, false>, CR::CPU_SSSE3);
+  CR(complexBE, complex, CR::VECTORIZED, &ssse3Swap<T, 2, false>, CR::CPU_SSSE3);
+  CR(real, realBE, CR::VECTORIZED, &ssse3Swap<T, 1, true>, CR::CPU_SSSE3);
+  CR(complex, complexBE, CR::VECTORIZED, &ssse3Swap<T, 2, true>, CR::CPU_SSSE3);
+}
+#endif
+
+/*!
+ * Register the converters between the big-endian formats and every native format.
+ * Called from lateLoadDefaultConverters().
+ */
+void lateLoadByteSwapConverters(void)
+{
+  registerBigEndianMatrix(BigEndianFormats());
+  CR::registerSaturatingFunction(SOAPY_SDR_F32, SOAPY_SDR_S16_BE, CR::GENERIC, &genericF32toS16BigEndianSat<1>);
+  CR::registerSaturatingFunction(SOAPY_SDR_CF32, SOAPY_SDR_CS16_BE, CR::GENERIC, &genericF32toS16BigEndianSat<2>);
+
+#ifdef SOAPY_SDR_SSSE3_SWAP
+  registerSSSE3Swap<int16_t>(SOAPY_SDR_S16_BE, SOAPY_SDR_CS16_BE, SOAPY_SDR_S16, SOAPY_SDR_CS16);
+  registerSSSE3Swap<int32_t>(SOAPY_SDR_S32_BE, SOAPY_SDR_CS32_BE, SOAPY_SDR_S32, SOAPY_SDR_CS32);
+  registerSSSE3Swap<float>(SOAPY_SDR_F32_BE, SOAPY_SDR_CF32_BE, SOAPY_SDR_F32, SOAPY_SDR_CF32);
+  CR(SOAPY_SDR_CS16_BE, SOAPY_SDR_CF32, CR::VECTORIZED, &ssse3CS16BEtoCF32, CR::CPU_SSSE3);
+  CR(SOAPY_SDR_CF32, SOAPY_SDR_CS16_BE, CR::VECTORIZED, &ssse3CF32toCS16BE, CR::CPU_SSSE3);
+  CR::registerSaturatingFunction(SOAPY_SDR_CF32, SOAPY_SDR_CS16_BE, CR::VECTORIZED, &ssse3CF32toCS16BESat, CR::CPU_SSSE3);
+#endif
+}
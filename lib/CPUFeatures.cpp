@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+
+std::string getEnvImpl(const char *name);
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define SOAPY_SDR_CPU_X86
+
+#ifdef _MSC_VER
+#include <intrin.h>
+
+static void cpuid(const int leaf, const int subleaf, unsigned regs[4])
+{
+    int out[4];
+    __cpuidex(out, leaf, subleaf);
+    for (size_t i = 0; i < 4; i++) regs[i] = unsigned(out[i]);
+}
+
+static unsigned long long xgetbv0(void)
+{
+    return _xgetbv(0);
+}
+
+#else
+#include <cpuid.h>
+
+static void cpuid(const int leaf, const int subleaf, unsigned regs[4])
+{
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+}
+
+static unsigned long long xgetbv0(void)
+{
+    unsigned lo, hi;
+    __asm__ __volatile__ ("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return (static_cast<unsigned long long>(hi) << 32) | lo;
+}
+
+#endif
+#endif //SOAPY_SDR_CPU_X86
+
+/***********************************************************************
+ * Query the processor and the OS for usable instruction sets
+ **********************************************************************/
+static int detectCPUFeatures(void)
+{
+    int features = 0;
+
+    #ifdef SOAPY_SDR_CPU_X86
+    typedef SoapySDR::ConverterRegistry CR;
+    unsigned regs[4]; //eax, ebx, ecx, edx
+
+    cpuid(0, 0, regs);
+    const unsigned maxLeaf = regs[0];
+    if (maxLeaf < 1) return features;
+
+    cpuid(1, 0, regs);
+    const unsigned ecx1 = regs[2], edx1 = regs[3];
+    if (edx1 & (1u << 26)) features |= CR::CPU_SSE2;
+    if (ecx1 & (1u << 9)) features |= CR::CPU_SSSE3;
+    if (ecx1 & (1u << 19)) features |= CR::CPU_SSE41;
+
+    //the YMM and ZMM register state must be enabled by the OS as well
+    const bool osxsave = (ecx1 & (1u << 27)) != 0;
+    const unsigned long long xcr0 = osxsave?xgetbv0():0;
+    const bool ymmState = (xcr0 & 0x6) == 0x6;
+    const bool zmmState = (xcr0 & 0xe6) == 0xe6;
+
+    if (not ymmState) return features;
+    if (ecx1 & (1u << 28)) features |= CR::CPU_AVX;
+    if (ecx1 & (1u << 12)) features |= CR::CPU_FMA;
+    if (ecx1 & (1u << 29)) features |= CR::CPU_F16C;
+
+    if (maxLeaf < 7) return features;
+    cpuid(7, 0, regs);
+    const unsigned ebx7 = regs[1];
+    if (ebx7 & (1u << 5)) features |= CR::CPU_AVX2;
+
+    if (not zmmState) return features;
+    if (ebx7 & (1u << 16)) features |= CR::CPU_AVX512F;
+    if (ebx7 & (1u << 30)) features |= CR::CPU_AVX512BW;
+    #endif //SOAPY_SDR_CPU_X86
+
+    return features;
+}
+
+/***********************************************************************
+ * The processor brand string, used to key per-host tuning data
+ **********************************************************************/
+std::string getCPUModelName(void)
+{
+    #ifdef SOAPY_SDR_CPU_X86
+    unsigned regs[4];
+    cpuid(0x80000000, 0, regs);
+    if (regs[0] >= 0x80000004)
+    {
+        char brand[49] = {};
+        for (unsigned leaf = 0; leaf < 3; leaf++)
+        {
+            cpuid(0x80000002+leaf, 0, regs);
+            std::memcpy(brand+leaf*16, regs, 16);
+        }
+        std::string name(brand);
+        const size_t first = name.find_first_not_of(' ');
+        const size_t last = name.find_last_not_of(' ');
+        if (first != std::string::npos) return name.substr(first, last-first+1);
+    }
+    #endif //SOAPY_SDR_CPU_X86
+
+    return "unknown";
+}
+
+int SoapySDR::ConverterRegistry::getCPUFeatures(void)
+{
+    static const int features = []()
+    {
+        int mask = detectCPUFeatures();
+        const std::string restrict = getEnvImpl("SOAPY_SDR_CPU_FEATURES");
+        if (not restrict.empty()) mask &= int(std::strtol(restrict.c_str(), nullptr, 0));
+        return mask;
+    }();
+    return features;
+}
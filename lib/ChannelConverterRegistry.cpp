@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "SnapshotRegistry.hpp"
+#include <SoapySDR/ChannelConverterRegistry.hpp>
+#include <SoapySDR/Logger.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+#include <map>
+
+void lateLoadChannelConverters(void);
+bool moreCapableFeatures(const int cpuFeatures, const int otherFeatures);
+
+/***********************************************************************
+ * Registry storage
+ *
+ * The table lives in a copy-on-write snapshot like the ConverterRegistry,
+ * see SnapshotRegistry.
+ **********************************************************************/
+typedef std::tuple<std::string, std::string, SoapySDR::ChannelConverterRegistry::Direction> ChannelConverterKey;
+
+struct ChannelConverterEntry
+{
+  SoapySDR::ChannelConverterRegistry::ChannelConverterFunction function;
+  int cpuFeatures;
+};
+
+typedef std::map<ChannelConverterKey, std::map<SoapySDR::ConverterRegistry::FunctionPriority, ChannelConverterEntry>> ChannelConverterTable;
+
+//leaked, since converters may be looked up during static destruction
+static SnapshotRegistry<ChannelConverterTable> &registry(void)
+{
+  static auto *instance = new SnapshotRegistry<ChannelConverterTable>();
+  return *instance;
+}
+
+//! Open a registration batch, the registrations are published by the matching end call
+void beginChannelConverterRegistration(void)
+{
+  registry().begin();
+}
+
+//! Close a registration batch and publish its registrations
+void endChannelConverterRegistration(void)
+{
+  registry().end();
+}
+
+static std::string directionToString(const SoapySDR::ChannelConverterRegistry::Direction direction)
+{
+  return (direction == SoapySDR::ChannelConverterRegistry::INTERLEAVE)?"INTERLEAVE":"DEINTERLEAVE";
+}
+
+SoapySDR::ChannelConverterRegistry::ChannelConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const Direction direction, const ConverterRegistry::FunctionPriority &priority, ChannelConverterFunction converter, const int cpuFeatures)
+{
+  if ((cpuFeatures & ConverterRegistry::getCPUFeatures()) != cpuFeatures)
+    {
+      SoapySDR::logf(SOAPY_SDR_DEBUG, "SoapySDR::ChannelConverterRegistry(%s, %s, %s, %s) skipped, CPU features 0x%x not supported",
+        sourceFormat.c_str(), targetFormat.c_str(), directionToString(direction).c_str(), std::to_string(priority).c_str(), cpuFeatures);
+      return;
+    }
+
+  ChannelConverterTable &pending = registry().begin();
+  const auto key = std::make_tuple(sourceFormat, targetFormat, direction);
+
+  const auto it = pending.find(key);
+  if (it != pending.end() and it->second.count(priority) != 0)
+    {
+      const int existingFeatures = it->second.at(priority).cpuFeatures;
+      if (existingFeatures == cpuFeatures)
+        {
+          SoapySDR::logf(SOAPY_SDR_ERROR, "SoapySDR::ChannelConverterRegistry(%s, %s, %s, %s) duplicate registration",
+            sourceFormat.c_str(), targetFormat.c_str(), directionToString(direction).c_str(), std::to_string(priority).c_str());
+          registry().end();
+          return;
+        }
+    }
+
+  //keep the most capable converter that this host supports
+  if (it == pending.end() or it->second.count(priority) == 0 or moreCapableFeatures(cpuFeatures, it->second.at(priority).cpuFeatures))
+    {
+      ChannelConverterEntry entry;
+      entry.function = converter;
+      entry.cpuFeatures = cpuFeatures;
+      pending[key][priority] = entry;
+      registry().markModified();
+    }
+  registry().end();
+}
+
+std::vector<std::string> SoapySDR::ChannelConverterRegistry::listTargetFormats(const std::string &sourceFormat, const Direction direction)
+{
+  lateLoadChannelConverters();
+
+  std::vector<std::string> targets;
+  const auto table = registry().read();
+  for (const auto &it : *table)
+    {
+      if (std::get<0>(it.first) != sourceFormat or std::get<2>(it.first) != direction) continue;
+      targets.push_back(std::get<1>(it.first));
+    }
+  std::sort(targets.begin(), targets.end());
+  return targets;
+}
+
+std::vector<SoapySDR::ConverterRegistry::FunctionPriority> SoapySDR::ChannelConverterRegistry::listPriorities(const std::string &sourceFormat, const std::string &targetFormat, const Direction direction)
+{
+  lateLoadChannelConverters();
+
+  std::vector<ConverterRegistry::FunctionPriority> priorities;
+  const auto table = registry().read();
+  const auto it = table->find(std::make_tuple(sourceFormat, targetFormat, direction));
+  if (it == table->end()) return priorities;
+  for (const auto &entry : it->second) priorities.push_back(entry.first);
+  return priorities;
+}
+
+SoapySDR::ChannelConverterRegistry::ChannelConverterFunction SoapySDR::ChannelConverterRegistry::getFunction(const std::string &sourceFormat, const std::string &targetFormat, const Direction direction)
+{
+  lateLoadChannelConverters();
+
+  const auto table = registry().read();
+  const auto it = table->find(std::make_tuple(sourceFormat, targetFormat, direction));
+  if (it == table->end() or it->second.empty())
+    {
+      throw std::runtime_error("ChannelConverterRegistry::getFunction() conversion not registered; "
+                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", direction="+directionToString(direction));
+    }
+  return it->second.rbegin()->second.function;
+}
+
+SoapySDR::ChannelConverterRegistry::ChannelConverterFunction SoapySDR::ChannelConverterRegistry::getFunction(const std::string &sourceFormat, const std::string &targetFormat, const Direction direction, const ConverterRegistry::FunctionPriority &priority)
+{
+  lateLoadChannelConverters();
+
+  const auto table = registry().read();
+  const auto it = table->find(std::make_tuple(sourceFormat, targetFormat, direction));
+  if (it == table->end() or it->second.count(priority) == 0)
+    {
+      throw std::runtime_error("ChannelConverterRegistry::getFunction() conversion priority not registered; "
+                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", direction="+directionToString(direction)+", priority="+std::to_string(priority));
+    }
+  return it->second.at(priority).function;
+}
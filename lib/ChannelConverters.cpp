@@ -0,0 +1,533 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "SampleConversion.hpp"
+#include "VectorizedHelpers.hpp"
+#include <SoapySDR/ChannelConverterRegistry.hpp>
+#include <cstring> //memcpy
+#include <type_traits>
+
+void beginChannelConverterRegistration(void);
+void endChannelConverterRegistration(void);
+
+typedef SoapySDR::ChannelConverterRegistry CCR;
+
+// ********************************
+// Generic interleave and deinterleave
+//
+// One function per source type, target type, and element depth,
+// the samples are converted and scaled like the generic converters.
+
+template <typename From, typename To, size_t elemDepth>
+static void genericInterleave(const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
+{
+  const size_t stride = numChans*elemDepth;
+  for (size_t ch = 0; ch < numChans; ch++)
+    {
+      auto *src = (const From *)srcBuffs[ch];
+      auto *dst = (To *)dstBuffs[0] + ch*elemDepth;
+      if (scaler == 1.0)
+        {
+          for (size_t i = 0; i < numElems; i++)
+            for (size_t k = 0; k < elemDepth; k++)
+              dst[i*stride+k] = Sample<From, To>::convert(src[i*elemDepth+k]);
+        }
+      else
+        {
+          for (size_t i = 0; i < numElems; i++)
+            for (size_t k = 0; k < elemDepth; k++)
+              dst[i*stride+k] = scaleSample<From, To>(src[i*elemDepth+k], scaler);
+        }
+    }
+}
+
+template <typename From, typename To, size_t elemDepth>
+static void genericDeinterleave(const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
+{
+  const size_t stride = numChans*elemDepth;
+  for (size_t ch = 0; ch < numChans; ch++)
+    {
+      auto *src = (const From *)srcBuffs[0] + ch*elemDepth;
+      auto *dst = (To *)dstBuffs[ch];
+      if (scaler == 1.0)
+        {
+          for (size_t i = 0; i < numElems; i++)
+            for (size_t k = 0; k < elemDepth; k++)
+              dst[i*elemDepth+k] = Sample<From, To>::convert(src[i*stride+k]);
+        }
+      else
+        {
+          for (size_t i = 0; i < numElems; i++)
+            for (size_t k = 0; k < elemDepth; k++)
+              dst[i*elemDepth+k] = scaleSample<From, To>(src[i*stride+k], scaler);
+        }
+    }
+}
+
+#ifdef SOAPY_SDR_CONVERTERS_X86
+
+// ********************************
+// SSE2 transposes
+//
+// Same-format moves of 4 and 8 byte elements. Groups of 4 channels of 4 byte elements
+// go through a 4x4 transpose, 2 channels of 4 byte elements through an unpack,
+// and pairs of channels of 8 byte elements through a 2x2 transpose.
+// Other channel counts and scaled conversions use the generic functions.
+
+template <size_t elemSize>
+static inline bool sse2TransposeSupported(const size_t numChans)
+{
+  return (elemSize == 4)?(numChans == 2 or numChans % 4 == 0):(numChans % 2 == 0);
+}
+
+//copy the elements after the last full vector one at a time
+template <size_t elemSize>
+static inline void copyTail(const char *src, char *dst, const size_t srcStride, const size_t dstStride, const size_t first, const size_t numElems)
+{
+  for (size_t i = first; i < numElems; i++) std::memcpy(dst + i*dstStride, src + i*srcStride, elemSize);
+}
+
+template <typename T, size_t elemDepth>
+SOAPY_SDR_TARGET("sse2")
+static void sse2Interleave(const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
+{
+  static const size_t elemSize = sizeof(T)*elemDepth;
+  if (scaler != 1.0 or not sse2TransposeSupported<elemSize>(numChans))
+    {
+      return genericInterleave<T, T, elemDepth>(srcBuffs, dstBuffs, numChans, numElems, scaler);
+    }
+
+  auto *dst = (char *)dstBuffs[0];
+  const size_t stride = numChans*elemSize;
+  size_t i = 0;
+
+  if (elemSize == 4 and numChans == 2)
+    {
+      auto *a = (const float *)srcBuffs[0];
+      auto *b = (const float *)srcBuffs[1];
+      auto *out = (float *)dst;
+      for (; i+4 <= numElems; i += 4)
+        {
+          const __m128 va = _mm_loadu_ps(a+i);
+          const __m128 vb = _mm_loadu_ps(b+i);
+          _mm_storeu_ps(out+2*i+0, _mm_unpacklo_ps(va, vb));
+          _mm_storeu_ps(out+2*i+4, _mm_unpackhi_ps(va, vb));
+        }
+    }
+  else if (elemSize == 4)
+    {
+      auto *out = (float *)dst;
+      for (; i+4 <= numElems; i += 4)
+        {
+          for (size_t g = 0; g < numChans; g += 4)
+            {
+              __m128 r0 = _mm_loadu_ps((const float *)srcBuffs[g+0]+i);
+              __m128 r1 = _mm_loadu_ps((const float *)srcBuffs[g+1]+i);
+              __m128 r2 = _mm_loadu_ps((const float *)srcBuffs[g+2]+i);
+              __m128 r3 = _mm_loadu_ps((const float *)srcBuffs[g+3]+i);
+              _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+              _mm_storeu_ps(out+(i+0)*numChans+g, r0);
+              _mm_storeu_ps(out+(i+1)*numChans+g, r1);
+              _mm_storeu_ps(out+(i+2)*numChans+g, r2);
+              _mm_storeu_ps(out+(i+3)*numChans+g, r3);
+            }
+        }
+    }
+  else
+    {
+      auto *out = (double *)dst;
+      for (; i+2 <= numElems; i += 2)
+        {
+          for (size_t g = 0; g < numChans; g += 2)
+            {
+              const __m128d a = _mm_loadu_pd((const double *)srcBuffs[g+0]+i);
+              const __m128d b = _mm_loadu_pd((const double *)srcBuffs[g+1]+i);
+              _mm_storeu_pd(out+(i+0)*numChans+g, _mm_unpacklo_pd(a, b));
+              _mm_storeu_pd(out+(i+1)*numChans+g, _mm_unpackhi_pd(a, b));
+            }
+        }
+    }
+
+  for (size_t ch = 0; ch < numChans; ch++)
+    {
+      copyTail<elemSize>((const char *)srcBuffs[ch], dst + ch*elemSize, elemSize, stride, i, numElems);
+    }
+}
+
+template <typename T, size_t elemDepth>
+SOAPY_SDR_TARGET("sse2")
+static void sse2Deinterleave(const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
+{
+  static const size_t elemSize = sizeof(T)*elemDepth;
+  if (scaler != 1.0 or not sse2TransposeSupported<elemSize>(numChans))
+    {
+      return genericDeinterleave<T, T, elemDepth>(srcBuffs, dstBuffs, numChans, numElems, scaler);
+    }
+
+  auto *src = (const char *)srcBuffs[0];
+  const size_t stride = numChans*elemSize;
+  size_t i = 0;
+
+  if (elemSize == 4 and numChans == 2)
+    {
+      auto *in = (const float *)src;
+      auto *a = (float *)dstBuffs[0];
+      auto *b = (float *)dstBuffs[1];
+      for (; i+4 <= numElems; i += 4)
+        {
+          const __m128 x = _mm_loadu_ps(in+2*i+0);
+          const __m128 y = _mm_loadu_ps(in+2*i+4);
+          _mm_storeu_ps(a+i, _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0)));
+          _mm_storeu_ps(b+i, _mm_shuffle_ps(x, y, _MM_SHUFFLE(3, 1, 3, 1)));
+        }
+    }
+  else if (elemSize == 4)
+    {
+      auto *in = (const float *)src;
+      for (; i+4 <= numElems; i += 4)
+        {
+          for (size_t g = 0; g < numChans; g += 4)
+            {
+              __m128 r0 = _mm_loadu_ps(in+(i+0)*numChans+g);
+              __m128 r1 = _mm_loadu_ps(in+(i+1)*numChans+g);
+              __m128 r2 = _mm_loadu_ps(in+(i+2)*numChans+g);
+              __m128 r3 = _mm_loadu_ps(in+(i+3)*numChans+g);
+              _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+              _mm_storeu_ps((float *)dstBuffs[g+0]+i, r0);
+              _mm_storeu_ps((float *)dstBuffs[g+1]+i, r1);
+              _mm_storeu_ps((float *)dstBuffs[g+2]+i, r2);
+              _mm_storeu_ps((float *)dstBuffs[g+3]+i, r3);
+            }
+        }
+    }
+  else
+    {
+      auto *in = (const double *)src;
+      for (; i+2 <= numElems; i += 2)
+        {
+          for (size_t g = 0; g < numChans; g += 2)
+            {
+              const __m128d x = _mm_loadu_pd(in+(i+0)*numChans+g);
+              const __m128d y = _mm_loadu_pd(in+(i+1)*numChans+g);
+              _mm_storeu_pd((double *)dstBuffs[g+0]+i, _mm_unpacklo_pd(x, y));
+              _mm_storeu_pd((double *)dstBuffs[g+1]+i, _mm_unpackhi_pd(x, y));
+            }
+        }
+    }
+
+  for (size_t ch = 0; ch < numChans; ch++)
+    {
+      copyTail<elemSize>(src + ch*elemSize, (char *)dstBuffs[ch], stride, elemSize, i, numElems);
+    }
+}
+
+// ********************************
+// SSE2 fused conversion and transpose
+//
+// CS16 and CS8 to and from CF32 for the channel counts of the SSE2 transposes.
+// Integer samples travel as 16-bit lanes, one 32-bit word per complex sample,
+// so the 4 byte transposes above move 4 complex samples per channel in registers.
+// The float side is converted with the vector converter arithmetic on its way
+// in or out, and scalers that cannot be folded into one float multiplier
+// use the generic functions.
+
+//lane loads and stores of 4 complex samples of the integer formats
+template <typename I>
+struct SSE2Lanes;
+
+template <>
+struct SSE2Lanes<int16_t>
+{
+  static double fullScale(void)
+  {
+    return SoapySDR::S16_FULL_SCALE;
+  }
+
+  SOAPY_SDR_TARGET("sse2")
+  static inline __m128i load(const int16_t *in)
+  {
+    return _mm_loadu_si128((const __m128i *)in);
+  }
+
+  SOAPY_SDR_TARGET("sse2")
+  static inline void store(int16_t *out, const __m128i lanes)
+  {
+    _mm_storeu_si128((__m128i *)out, lanes);
+  }
+
+  SOAPY_SDR_TARGET("sse2")
+  static inline __m128i fromF32(const float *in, const __m128 factor)
+  {
+    return sse2F32toS16x8(in, factor);
+  }
+};
+
+template <>
+struct SSE2Lanes<int8_t>
+{
+  static double fullScale(void)
+  {
+    return SoapySDR::S8_FULL_SCALE;
+  }
+
+  SOAPY_SDR_TARGET("sse2")
+  static inline __m128i load(const int8_t *in)
+  {
+    const __m128i bytes = _mm_loadl_epi64((const __m128i *)in);
+    return _mm_srai_epi16(_mm_unpacklo_epi8(bytes, bytes), 8);
+  }
+
+  SOAPY_SDR_TARGET("sse2")
+  static inline void store(int8_t *out, const __m128i lanes)
+  {
+    _mm_storel_epi64((__m128i *)out, _mm_packs_epi16(lanes, lanes));
+  }
+
+  //wrapping like the scalar cast, the lanes hold the sign extended bytes
+  SOAPY_SDR_TARGET("sse2")
+  static inline __m128i fromF32(const float *in, const __m128 factor)
+  {
+    const __m128i lo = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(in+0), factor));
+    const __m128i hi = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(in+4), factor));
+    return _mm_packs_epi32(
+      _mm_srai_epi32(_mm_slli_epi32(lo, 24), 24),
+      _mm_srai_epi32(_mm_slli_epi32(hi, 24), 24));
+  }
+};
+
+template <typename I>
+SOAPY_SDR_TARGET("sse2")
+static inline __m128i sse2LoadLanes(const I *in, const __m128)
+{
+  return SSE2Lanes<I>::load(in);
+}
+
+template <typename I>
+SOAPY_SDR_TARGET("sse2")
+static inline __m128i sse2LoadLanes(const float *in, const __m128 factor)
+{
+  return SSE2Lanes<I>::fromF32(in, factor);
+}
+
+template <typename I>
+SOAPY_SDR_TARGET("sse2")
+static inline void sse2StoreLanes(I *out, const __m128i lanes, const __m128)
+{
+  SSE2Lanes<I>::store(out, lanes);
+}
+
+template <typename I>
+SOAPY_SDR_TARGET("sse2")
+static inline void sse2StoreLanes(float *out, const __m128i lanes, const __m128 factor)
+{
+  sse2S16toF32x8(lanes, factor, out);
+}
+
+//the integer format of a conversion, and the scale of its float multiplier
+template <typename From, typename To>
+struct FusedFormat
+{
+  typedef typename std::conditional<std::is_same<From, float>::value, To, From>::type Int;
+
+  static double scale(void)
+  {
+    return std::is_same<From, float>::value?SSE2Lanes<Int>::fullScale():1.0/SSE2Lanes<Int>::fullScale();
+  }
+};
+
+//offset every channel pointer to complex element first, for the generic tail
+template <typename T, typename Ptr>
+static inline void offsetChannels(Ptr const *ptrs, Ptr *offset, const size_t numChans, const size_t first)
+{
+  for (size_t ch = 0; ch < numChans; ch++) offset[ch] = (Ptr)((T *)ptrs[ch] + first*2);
+}
+
+template <typename From, typename To>
+SOAPY_SDR_TARGET("sse2")
+static void sse2FusedInterleave(const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
+{
+  typedef typename FusedFormat<From, To>::Int I;
+  float f;
+  if (numChans > 64 or not sse2TransposeSupported<4>(numChans) or not foldScaler(scaler, FusedFormat<From, To>::scale(), f))
+    {
+      return genericInterleave<From, To, 2>(srcBuffs, dstBuffs, numChans, numElems, scaler);
+    }
+
+  const __m128 factor = _mm_set1_ps(f);
+  auto *out = (To *)dstBuffs[0];
+  size_t i = 0;
+
+  if (numChans == 2)
+    {
+      auto *a = (const From *)srcBuffs[0];
+      auto *b = (const From *)srcBuffs[1];
+      for (; i+4 <= numElems; i += 4)
+        {
+          const __m128i va = sse2LoadLanes<I>(a+2*i, factor);
+          const __m128i vb = sse2LoadLanes<I>(b+2*i, factor);
+          sse2StoreLanes<I>(out+2*(2*i+0), _mm_unpacklo_epi32(va, vb), factor);
+          sse2StoreLanes<I>(out+2*(2*i+4), _mm_unpackhi_epi32(va, vb), factor);
+        }
+    }
+  else
+    {
+      for (; i+4 <= numElems; i += 4)
+        {
+          for (size_t g = 0; g < numChans; g += 4)
+            {
+              __m128 r0 = _mm_castsi128_ps(sse2LoadLanes<I>((const From *)srcBuffs[g+0]+2*i, factor));
+              __m128 r1 = _mm_castsi128_ps(sse2LoadLanes<I>((const From *)srcBuffs[g+1]+2*i, factor));
+              __m128 r2 = _mm_castsi128_ps(sse2LoadLanes<I>((const From *)srcBuffs[g+2]+2*i, factor));
+              __m128 r3 = _mm_castsi128_ps(sse2LoadLanes<I>((const From *)srcBuffs[g+3]+2*i, factor));
+              _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+              sse2StoreLanes<I>(out+2*((i+0)*numChans+g), _mm_castps_si128(r0), factor);
+              sse2StoreLanes<I>(out+2*((i+1)*numChans+g), _mm_castps_si128(r1), factor);
+              sse2StoreLanes<I>(out+2*((i+2)*numChans+g), _mm_castps_si128(r2), factor);
+              sse2StoreLanes<I>(out+2*((i+3)*numChans+g), _mm_castps_si128(r3), factor);
+            }
+        }
+    }
+
+  const void *srcTail[64];
+  void *dstTail = out+2*i*numChans;
+  offsetChannels<const From>(srcBuffs, srcTail, numChans, i);
+  genericInterleave<From, To, 2>(srcTail, &dstTail, numChans, numElems-i, scaler);
+}
+
+template <typename From, typename To>
+SOAPY_SDR_TARGET("sse2")
+static void sse2FusedDeinterleave(const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
+{
+  typedef typename FusedFormat<From, To>::Int I;
+  float f;
+  if (numChans > 64 or not sse2TransposeSupported<4>(numChans) or not foldScaler(scaler, FusedFormat<From, To>::scale(), f))
+    {
+      return genericDeinterleave<From, To, 2>(srcBuffs, dstBuffs, numChans, numElems, scaler);
+    }
+
+  const __m128 factor = _mm_set1_ps(f);
+  auto *in = (const From *)srcBuffs[0];
+  size_t i = 0;
+
+  if (numChans == 2)
+    {
+      auto *a = (To *)dstBuffs[0];
+      auto *b = (To *)dstBuffs[1];
+      for (; i+4 <= numElems; i += 4)
+        {
+          const __m128 x = _mm_castsi128_ps(sse2LoadLanes<I>(in+2*(2*i+0), factor));
+          const __m128 y = _mm_castsi128_ps(sse2LoadLanes<I>(in+2*(2*i+4), factor));
+          sse2StoreLanes<I>(a+2*i, _mm_castps_si128(_mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0))), factor);
+          sse2StoreLanes<I>(b+2*i, _mm_castps_si128(_mm_shuffle_ps(x, y, _MM_SHUFFLE(3, 1, 3, 1))), factor);
+        }
+    }
+  else
+    {
+      for (; i+4 <= numElems; i += 4)
+        {
+          for (size_t g = 0; g < numChans; g += 4)
+            {
+              __m128 r0 = _mm_castsi128_ps(sse2LoadLanes<I>(in+2*((i+0)*numChans+g), factor));
+              __m128 r1 = _mm_castsi128_ps(sse2LoadLanes<I>(in+2*((i+1)*numChans+g), factor));
+              __m128 r2 = _mm_castsi128_ps(sse2LoadLanes<I>(in+2*((i+2)*numChans+g), factor));
+              __m128 r3 = _mm_castsi128_ps(sse2LoadLanes<I>(in+2*((i+3)*numChans+g), factor));
+              _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+              sse2StoreLanes<I>((To *)dstBuffs[g+0]+2*i, _mm_castps_si128(r0), factor);
+              sse2StoreLanes<I>((To *)dstBuffs[g+1]+2*i, _mm_castps_si128(r1), factor);
+              sse2StoreLanes<I>((To *)dstBuffs[g+2]+2*i, _mm_castps_si128(r2), factor);
+              sse2StoreLanes<I>((To *)dstBuffs[g+3]+2*i, _mm_castps_si128(r3), factor);
+            }
+        }
+    }
+
+  const void *srcTail = in+2*i*numChans;
+  void *dstTail[64];
+  offsetChannels<To>(dstBuffs, dstTail, numChans, i);
+  genericDeinterleave<From, To, 2>(&srcTail, dstTail, numChans, numElems-i, scaler);
+}
+
+#endif //SOAPY_SDR_CONVERTERS_X86
+
+// ********************************
+// Registration
+
+template <typename Source, typename Target>
+static int registerChannelPair(void)
+{
+  typedef typename Source::Type From;
+  typedef typename Target::Type To;
+  const auto GENERIC = SoapySDR::ConverterRegistry::GENERIC;
+  CCR(Source::real(), Target::real(), CCR::INTERLEAVE, GENERIC, &genericInterleave<From, To, 1>);
+  CCR(Source::real(), Target::real(), CCR::DEINTERLEAVE, GENERIC, &genericDeinterleave<From, To, 1>);
+  CCR(Source::complex(), Target::complex(), CCR::INTERLEAVE, GENERIC, &genericInterleave<From, To, 2>);
+  CCR(Source::complex(), Target::complex(), CCR::DEINTERLEAVE, GENERIC, &genericDeinterleave<From, To, 2>);
+  return 0;
+}
+
+template <typename Source, typename... Targets>
+static int registerChannelSource(FormatList<Targets...>)
+{
+  const int pairs[] = {registerChannelPair<Source, Targets>()...};
+  return int(sizeof(pairs)/sizeof(pairs[0]));
+}
+
+template <typename... Sources>
+static int registerChannelMatrix(FormatList<Sources...> targets)
+{
+  const int sources[] = {registerChannelSource<Sources>(targets)...};
+  return int(sizeof(sources)/sizeof(sources[0]));
+}
+
+#ifdef SOAPY_SDR_CONVERTERS_X86
+template <typename T, size_t elemDepth>
+static void registerSSE2Transpose(const char *format)
+{
+  const auto VECTORIZED = SoapySDR::ConverterRegistry::VECTORIZED;
+  const auto SSE2 = SoapySDR::ConverterRegistry::CPU_SSE2;
+  CCR(format, format, CCR::INTERLEAVE, VECTORIZED, &sse2Interleave<T, elemDepth>, SSE2);
+  CCR(format, format, CCR::DEINTERLEAVE, VECTORIZED, &sse2Deinterleave<T, elemDepth>, SSE2);
+}
+
+template <typename I>
+static void registerSSE2Fused(const char *format)
+{
+  const auto VECTORIZED = SoapySDR::ConverterRegistry::VECTORIZED;
+  const auto SSE2 = SoapySDR::ConverterRegistry::CPU_SSE2;
+  CCR(format, SOAPY_SDR_CF32, CCR::INTERLEAVE, VECTORIZED, &sse2FusedInterleave<I, float>, SSE2);
+  CCR(format, SOAPY_SDR_CF32, CCR::DEINTERLEAVE, VECTORIZED, &sse2FusedDeinterleave<I, float>, SSE2);
+  CCR(SOAPY_SDR_CF32, format, CCR::INTERLEAVE, VECTORIZED, &sse2FusedInterleave<float, I>, SSE2);
+  CCR(SOAPY_SDR_CF32, format, CCR::DEINTERLEAVE, VECTORIZED, &sse2FusedDeinterleave<float, I>, SSE2);
+}
+#endif //SOAPY_SDR_CONVERTERS_X86
+
+/*!
+ * Register the interleave and deinterleave converters.
+ * Every pair of the default real and complex formats has a generic converter,
+ * same-format moves of 4 and 8 byte elements have SSE2 transposes,
+ * and CS16 and CS8 to and from CF32 have SSE2 fused conversion and transposes.
+ */
+void lateLoadChannelConverters(void)
+{
+  static const bool loaded = []()
+  {
+    beginChannelConverterRegistration();
+    registerChannelMatrix(DefaultFormats());
+
+    #ifdef SOAPY_SDR_CONVERTERS_X86
+    registerSSE2Transpose<float, 1>(SOAPY_SDR_F32);
+    registerSSE2Transpose<int32_t, 1>(SOAPY_SDR_S32);
+    registerSSE2Transpose<uint32_t, 1>(SOAPY_SDR_U32);
+    registerSSE2Transpose<int16_t, 2>(SOAPY_SDR_CS16);
+    registerSSE2Transpose<uint16_t, 2>(SOAPY_SDR_CU16);
+    registerSSE2Transpose<double, 1>(SOAPY_SDR_F64);
+    registerSSE2Transpose<float, 2>(SOAPY_SDR_CF32);
+    registerSSE2Transpose<int32_t, 2>(SOAPY_SDR_CS32);
+    registerSSE2Transpose<uint32_t, 2>(SOAPY_SDR_CU32);
+    registerSSE2Fused<int16_t>(SOAPY_SDR_CS16);
+    registerSSE2Fused<int8_t>(SOAPY_SDR_CS8);
+    #endif //SOAPY_SDR_CONVERTERS_X86
+
+    endChannelConverterRegistration();
+    return true;
+  }();
+  (void)loaded;
+}
@@ -0,0 +1,294 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Version.hpp>
+#include <SoapySDR/Logger.hpp>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <limits>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <cstdio>
+#include <cctype>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#define makeDir(path) _mkdir(path)
+#define getProcessId() _getpid()
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#define makeDir(path) mkdir(path, 0755)
+#define getProcessId() getpid()
+#endif
+
+std::string getEnvImpl(const char *name);
+std::string getCPUModelName(void);
+void beginConverterRegistration(void);
+void endConverterRegistration(void);
+void setTunedConverterPriority(const std::string &sourceFormat, const std::string &targetFormat, const SoapySDR::ConverterRegistry::FunctionPriority priority, const std::vector<SoapySDR::ConverterRegistry::FunctionPriority> &priorities);
+
+/***********************************************************************
+ * Cache file location
+ **********************************************************************/
+static std::string getCacheDirectory(void)
+{
+    const std::string override = getEnvImpl("SOAPY_SDR_CONVERTER_CACHE");
+    if (not override.empty()) return override;
+
+    #ifdef _WIN32
+    const std::string localAppData = getEnvImpl("LOCALAPPDATA");
+    if (not localAppData.empty()) return localAppData + "\\SoapySDR";
+    #else
+    const std::string xdgCache = getEnvImpl("XDG_CACHE_HOME");
+    if (not xdgCache.empty()) return xdgCache + "/SoapySDR";
+    const std::string home = getEnvImpl("HOME");
+    if (not home.empty()) return home + "/.cache/SoapySDR";
+    #endif
+    return "";
+}
+
+//a file name unique to the CPU model and the usable instruction sets
+static std::string getCacheFileName(void)
+{
+    std::string model = getCPUModelName();
+    for (auto &ch : model)
+    {
+        if (not std::isalnum((unsigned char)ch)) ch = '_';
+    }
+    char features[16];
+    std::snprintf(features, sizeof(features), "%x", SoapySDR::ConverterRegistry::getCPUFeatures());
+    return "converters_" + model + "_" + features + ".tune";
+}
+
+static const std::string CACHE_HEADER("# SoapySDR converter autotune cache");
+static const std::string CACHE_FOOTER("end");
+
+/***********************************************************************
+ * Load and store the tuned priorities
+ **********************************************************************/
+struct TunedPair
+{
+    std::string source;
+    std::string target;
+    SoapySDR::ConverterRegistry::FunctionPriority priority;
+
+    //the registered priorities that were compared, in ascending order
+    std::vector<SoapySDR::ConverterRegistry::FunctionPriority> priorities;
+};
+
+typedef std::vector<TunedPair> TunedPriorities;
+
+/*!
+ * The cache holds one line per pair: the formats, the tuned priority,
+ * and the comma separated priorities that were compared.
+ * A file without the footer line is incomplete and ignored.
+ */
+static bool loadCache(const std::string &path, TunedPriorities &tuned)
+{
+    std::ifstream in(path);
+    if (not in) return false;
+
+    //the cache is only valid for the library version that wrote it
+    std::string header, version;
+    std::getline(in, header);
+    std::getline(in, version);
+    if (header != CACHE_HEADER or version != "version " + SoapySDR::getLibVersion()) return false;
+
+    std::string line;
+    while (std::getline(in, line))
+    {
+        if (line == CACHE_FOOTER) return true;
+        std::stringstream ss(line);
+        TunedPair pair;
+        int priority = 0;
+        std::string priorities;
+        if (not (ss >> pair.source >> pair.target >> priority >> priorities)) return false;
+        pair.priority = SoapySDR::ConverterRegistry::FunctionPriority(priority);
+
+        std::stringstream list(priorities);
+        std::string item;
+        while (std::getline(list, item, ','))
+        {
+            pair.priorities.push_back(SoapySDR::ConverterRegistry::FunctionPriority(std::atoi(item.c_str())));
+        }
+        tuned.push_back(pair);
+    }
+    return false;
+}
+
+/*!
+ * Write the cache to a temporary file in the cache directory and rename it
+ * over the cache file, so that readers never see a partial file, even when
+ * several processes tune at once or the process dies while writing.
+ */
+static void storeCache(const std::string &directory, const std::string &path, const TunedPriorities &tuned)
+{
+    //create the directory and its parent, failures show up when opening the file
+    const size_t parentPos = directory.find_last_of("/\\");
+    if (parentPos != std::string::npos) makeDir(directory.substr(0, parentPos).c_str());
+    makeDir(directory.c_str());
+
+    const std::string tempPath = path + "." + std::to_string(getProcessId()) + ".tmp";
+    {
+        std::ofstream out(tempPath);
+        out << CACHE_HEADER << std::endl;
+        out << "version " << SoapySDR::getLibVersion() << std::endl;
+        for (const auto &pair : tuned)
+        {
+            out << pair.source << " " << pair.target << " " << int(pair.priority) << " ";
+            for (size_t i = 0; i < pair.priorities.size(); i++)
+            {
+                out << (i == 0?"":",") << int(pair.priorities[i]);
+            }
+            out << std::endl;
+        }
+        out << CACHE_FOOTER << std::endl;
+        out.close();
+        if (not out)
+        {
+            SoapySDR::logf(SOAPY_SDR_WARNING, "ConverterRegistry::autotune() failed to write %s", tempPath.c_str());
+            std::remove(tempPath.c_str());
+            return;
+        }
+    }
+
+    #ifdef _WIN32
+    //rename() does not replace an existing file on Windows
+    std::remove(path.c_str());
+    #endif
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0)
+    {
+        SoapySDR::logf(SOAPY_SDR_WARNING, "ConverterRegistry::autotune() failed to write %s", path.c_str());
+        std::remove(tempPath.c_str());
+    }
+}
+
+//the cache only applies when it tuned exactly the pairs and priorities registered now
+static bool cacheMatches(const TunedPriorities &cached, const TunedPriorities &pairs)
+{
+    if (cached.size() != pairs.size()) return false;
+    for (size_t i = 0; i < pairs.size(); i++)
+    {
+        if (cached[i].source != pairs[i].source or cached[i].target != pairs[i].target) return false;
+        if (cached[i].priorities != pairs[i].priorities) return false;
+    }
+    return true;
+}
+
+/***********************************************************************
+ * Benchmark the priorities of one source/target pair
+ **********************************************************************/
+static double timeConverter(const SoapySDR::ConverterRegistry::ConverterFunction function, const std::vector<char> &src, std::vector<char> &dst, const size_t numElems)
+{
+    //best of several trials, each long enough for the clock resolution
+    double best = std::numeric_limits<double>::max();
+    for (size_t trial = 0; trial < 3; trial++)
+    {
+        size_t numCalls = 0;
+        double seconds = 0.0;
+        const auto t0 = std::chrono::high_resolution_clock::now();
+        do
+        {
+            function(src.data(), dst.data(), numElems, 1.0);
+            numCalls++;
+            seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t0).count();
+        } while (seconds < 1e-3);
+        best = std::min(best, seconds/numCalls);
+    }
+    return best;
+}
+
+static SoapySDR::ConverterRegistry::FunctionPriority tunePair(const std::string &source, const std::string &target)
+{
+    typedef SoapySDR::ConverterRegistry CR;
+
+    //a typical stream packet, and a buffer that spills out of the L1 cache
+    static const size_t sizes[] = {1024, 32768};
+
+    const auto priorities = CR::listPriorities(source, target);
+    const size_t maxElems = sizes[1];
+
+    //the byte pattern is a normal value in every float format and mid-scale in every integer format
+    std::vector<char> src(maxElems*SoapySDR::formatToSize(source), 0x11);
+    std::vector<char> dst(maxElems*SoapySDR::formatToSize(target));
+
+    std::vector<double> score(priorities.size(), 0.0);
+    for (const size_t numElems : sizes)
+    {
+        for (size_t i = 0; i < priorities.size(); i++)
+        {
+            score[i] += timeConverter(CR::getFunction(source, target, priorities[i]), src, dst, numElems)/numElems;
+        }
+    }
+
+    //ties go to the higher priority
+    size_t best = priorities.size()-1;
+    for (size_t i = priorities.size(); i-- > 0;)
+    {
+        if (score[i] < score[best]) best = i;
+    }
+    return priorities[best];
+}
+
+/***********************************************************************
+ * Autotune entry points
+ **********************************************************************/
+void SoapySDR::ConverterRegistry::autotune(const bool force)
+{
+    const std::string directory = getCacheDirectory();
+    const std::string path = directory.empty()?"":(directory + "/" + getCacheFileName());
+
+    //the pairs with a choice of converters, and their registered priorities
+    TunedPriorities pairs;
+    for (const auto &source : listAvailableSourceFormats())
+    {
+        if (formatToSize(source) == 0) continue;
+        for (const auto &target : listTargetFormats(source))
+        {
+            if (formatToSize(target) == 0) continue;
+            TunedPair pair;
+            pair.source = source;
+            pair.target = target;
+            pair.priorities = listPriorities(source, target);
+            if (pair.priorities.size() < 2) continue;
+            pairs.push_back(pair);
+        }
+    }
+
+    TunedPriorities tuned;
+    if (force or path.empty() or not loadCache(path, tuned) or not cacheMatches(tuned, pairs))
+    {
+        tuned = pairs;
+        for (auto &pair : tuned) pair.priority = tunePair(pair.source, pair.target);
+        if (not path.empty()) storeCache(directory, path, tuned);
+        SoapySDR::logf(SOAPY_SDR_DEBUG, "ConverterRegistry::autotune() tuned %d conversions", int(tuned.size()));
+    }
+
+    beginConverterRegistration();
+    for (const auto &pair : tuned)
+    {
+        setTunedConverterPriority(pair.source, pair.target, pair.priority, pair.priorities);
+    }
+    endConverterRegistration();
+}
+
+bool autotuneFromEnvironment(void)
+{
+    if (getEnvImpl("SOAPY_SDR_CONVERTER_AUTOTUNE") != "1") return false;
+    try
+    {
+        SoapySDR::ConverterRegistry::autotune();
+    }
+    catch (const std::exception &ex)
+    {
+        SoapySDR::logf(SOAPY_SDR_ERROR, "ConverterRegistry::autotune() failed: %s", ex.what());
+        return false;
+    }
+    return true;
+}
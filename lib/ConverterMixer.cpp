@@ -0,0 +1,315 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/ConverterMixer.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include "VectorizedHelpers.hpp"
+#include <stdexcept>
+#include <algorithm>
+#include <cmath>
+
+//elements per chunk, the phasors are resynchronized at the start of every chunk
+//and the CF32 scratch buffer of 4 KiB stays in L1 cache between the passes
+static const size_t MIX_CHUNK_ELEMS = 512;
+
+static const double TWO_PI = 6.283185307179586476925286766559;
+
+/***********************************************************************
+ * Oscillator phasors
+ **********************************************************************/
+
+//the phasors of the first lanes consecutive samples, and the rotation that advances each one by lanes samples,
+//computed by complex rotation in double precision with two evaluations of sin and cos
+static void lanePhasors(const double phase, const double frequency, const size_t lanes, float *start, float *step)
+{
+  const double dr = std::cos(TWO_PI*frequency), di = std::sin(TWO_PI*frequency);
+  double pr = std::cos(TWO_PI*phase), pi = std::sin(TWO_PI*phase);
+  double sr = 1.0, si = 0.0;
+  for (size_t k = 0; k < lanes; k++)
+    {
+      start[2*k+0] = float(pr);
+      start[2*k+1] = float(pi);
+      const double nextPr = pr*dr - pi*di;
+      pi = pr*di + pi*dr;
+      pr = nextPr;
+      const double nextSr = sr*dr - si*di;
+      si = sr*di + si*dr;
+      sr = nextSr;
+    }
+  for (size_t k = 0; k < lanes; k++)
+    {
+      step[2*k+0] = float(sr);
+      step[2*k+1] = float(si);
+    }
+}
+
+/***********************************************************************
+ * Generic kernel
+ **********************************************************************/
+
+//the input is CF32 or CS16, scaled by factor before mixing
+template <bool fromCS16>
+static inline void loadComplex(const void *inBuff, const size_t i, const float factor, float &re, float &im)
+{
+  if (fromCS16)
+    {
+      const auto *in = (const int16_t *)inBuff;
+      re = float(in[2*i+0])*factor;
+      im = float(in[2*i+1])*factor;
+    }
+  else
+    {
+      const auto *in = (const float *)inBuff;
+      re = in[2*i+0]*factor;
+      im = in[2*i+1]*factor;
+    }
+}
+
+template <bool fromCS16>
+static void genericMix(const void *inBuff, float *out, const size_t numElems, const float factor, const double phase, const double frequency)
+{
+  float p[2], r[2];
+  lanePhasors(phase, frequency, 1, p, r);
+  for (size_t i = 0; i < numElems; i++)
+    {
+      float re, im;
+      loadComplex<fromCS16>(inBuff, i, factor, re, im);
+      out[2*i+0] = re*p[0] - im*p[1];
+      out[2*i+1] = re*p[1] + im*p[0];
+      const float pr = p[0]*r[0] - p[1]*r[1];
+      p[1] = p[0]*r[1] + p[1]*r[0];
+      p[0] = pr;
+    }
+}
+
+#ifdef SOAPY_SDR_CONVERTERS_X86
+
+/***********************************************************************
+ * SSE3 kernel, 2 samples per vector and 4 per iteration
+ **********************************************************************/
+
+//complex multiply of interleaved pairs
+SOAPY_SDR_TARGET("sse3")
+static inline __m128 sse3ComplexMul(const __m128 x, const __m128 p)
+{
+  const __m128 swapped = _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+  return _mm_addsub_ps(_mm_mul_ps(x, _mm_moveldup_ps(p)), _mm_mul_ps(swapped, _mm_movehdup_ps(p)));
+}
+
+template <bool fromCS16>
+SOAPY_SDR_TARGET("sse3")
+static void sse3Mix(const void *inBuff, float *out, const size_t numElems, const float factor, const double phase, const double frequency)
+{
+  //two phasor vectors interleave the rotations, which halves the dependency chain
+  alignas(16) float start[8], step[8];
+  lanePhasors(phase, frequency, 4, start, step);
+  __m128 p0 = _mm_load_ps(start+0);
+  __m128 p1 = _mm_load_ps(start+4);
+  const __m128 r = _mm_load_ps(step);
+  const __m128 f = _mm_set1_ps(factor);
+
+  size_t i = 0;
+  for (; i+4 <= numElems; i += 4)
+    {
+      __m128 x0, x1;
+      if (fromCS16)
+        {
+          const __m128i in = _mm_loadu_si128((const __m128i *)((const int16_t *)inBuff+2*i));
+          x0 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16));
+          x1 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16));
+        }
+      else
+        {
+          x0 = _mm_loadu_ps((const float *)inBuff+2*i+0);
+          x1 = _mm_loadu_ps((const float *)inBuff+2*i+4);
+        }
+      _mm_storeu_ps(out+2*i+0, sse3ComplexMul(_mm_mul_ps(x0, f), p0));
+      _mm_storeu_ps(out+2*i+4, sse3ComplexMul(_mm_mul_ps(x1, f), p1));
+      p0 = sse3ComplexMul(p0, r);
+      p1 = sse3ComplexMul(p1, r);
+    }
+  const size_t inBytes = fromCS16?(2*sizeof(int16_t)):(2*sizeof(float));
+  genericMix<fromCS16>((const char *)inBuff+i*inBytes, out+2*i, numElems-i, factor, phase + i*frequency, frequency);
+}
+
+/***********************************************************************
+ * AVX kernel, 4 samples per vector and 8 per iteration
+ **********************************************************************/
+
+SOAPY_SDR_TARGET("avx")
+static inline __m256 avxComplexMul(const __m256 x, const __m256 p)
+{
+  const __m256 swapped = _mm256_permute_ps(x, _MM_SHUFFLE(2, 3, 0, 1));
+  return _mm256_addsub_ps(_mm256_mul_ps(x, _mm256_moveldup_ps(p)), _mm256_mul_ps(swapped, _mm256_movehdup_ps(p)));
+}
+
+template <bool fromCS16>
+SOAPY_SDR_TARGET("avx")
+static void avxMix(const void *inBuff, float *out, const size_t numElems, const float factor, const double phase, const double frequency)
+{
+  alignas(32) float start[16], step[16];
+  lanePhasors(phase, frequency, 8, start, step);
+  __m256 p0 = _mm256_load_ps(start+0);
+  __m256 p1 = _mm256_load_ps(start+8);
+  const __m256 r = _mm256_load_ps(step);
+  const __m256 f = _mm256_set1_ps(factor);
+
+  size_t i = 0;
+  for (; i+8 <= numElems; i += 8)
+    {
+      __m256 x0, x1;
+      if (fromCS16)
+        {
+          const __m128i in0 = _mm_loadu_si128((const __m128i *)((const int16_t *)inBuff+2*i+0));
+          const __m128i in1 = _mm_loadu_si128((const __m128i *)((const int16_t *)inBuff+2*i+8));
+          x0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(in0, in0), 16))),
+            _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(in0, in0), 16)), 1);
+          x1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(in1, in1), 16))),
+            _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(in1, in1), 16)), 1);
+        }
+      else
+        {
+          x0 = _mm256_loadu_ps((const float *)inBuff+2*i+0);
+          x1 = _mm256_loadu_ps((const float *)inBuff+2*i+8);
+        }
+      _mm256_storeu_ps(out+2*i+0, avxComplexMul(_mm256_mul_ps(x0, f), p0));
+      _mm256_storeu_ps(out+2*i+8, avxComplexMul(_mm256_mul_ps(x1, f), p1));
+      p0 = avxComplexMul(p0, r);
+      p1 = avxComplexMul(p1, r);
+    }
+  const size_t inBytes = fromCS16?(2*sizeof(int16_t)):(2*sizeof(float));
+  genericMix<fromCS16>((const char *)inBuff+i*inBytes, out+2*i, numElems-i, factor, phase + i*frequency, frequency);
+}
+
+#endif //SOAPY_SDR_CONVERTERS_X86
+
+//select the widest kernel that the host supports
+template <bool fromCS16>
+static SoapySDR::ConverterMixer::MixFunction selectMix(void)
+{
+#ifdef SOAPY_SDR_CONVERTERS_X86
+  const int features = SoapySDR::ConverterRegistry::getCPUFeatures();
+  if ((features & SoapySDR::ConverterRegistry::CPU_AVX) != 0) return &avxMix<fromCS16>;
+  if ((features & SoapySDR::ConverterRegistry::CPU_SSSE3) != 0) return &sse3Mix<fromCS16>;
+#endif //SOAPY_SDR_CONVERTERS_X86
+  return &genericMix<fromCS16>;
+}
+
+/***********************************************************************
+ * ConverterMixer
+ **********************************************************************/
+
+SoapySDR::ConverterMixer::ConverterMixer(void):
+  _mix(nullptr),
+  _factor(1.0f),
+  _frequency(0.0),
+  _phase(0.0),
+  _scaler(1.0)
+{
+  return;
+}
+
+static bool isComplexFormat(const std::string &format)
+{
+  return not format.empty() and format[0] == 'C';
+}
+
+SoapySDR::ConverterMixer::ConverterMixer(const std::string &sourceFormat, const std::string &targetFormat, const double frequency, const double scaler):
+  _sourceFormat(sourceFormat),
+  _targetFormat(targetFormat),
+  _mix(nullptr),
+  _factor(1.0f),
+  _frequency(frequency),
+  _phase(0.0),
+  _scaler(scaler)
+{
+  if (not isComplexFormat(sourceFormat) or not isComplexFormat(targetFormat))
+    {
+      throw std::runtime_error("ConverterMixer() formats must be complex; "
+                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
+    }
+
+  //CF32 and CS16 are read by the mixing kernel, other formats are converted to CF32 first
+  if (sourceFormat == SOAPY_SDR_CF32)
+    {
+      _mix = selectMix<false>();
+      _factor = float(scaler);
+    }
+  else if (sourceFormat == SOAPY_SDR_CS16)
+    {
+      _mix = selectMix<true>();
+      _factor = float(scaler/S16_FULL_SCALE);
+    }
+  else
+    {
+      _inPlan = ConverterPlan(sourceFormat, SOAPY_SDR_CF32, scaler);
+      _mix = selectMix<false>();
+    }
+
+  if (targetFormat != SOAPY_SDR_CF32) _outPlan = ConverterPlan(SOAPY_SDR_CF32, targetFormat);
+}
+
+bool SoapySDR::ConverterMixer::isValid(void) const
+{
+  return _mix != nullptr;
+}
+
+void SoapySDR::ConverterMixer::execute(const void *srcBuff, void *dstBuff, const size_t numElems)
+{
+  alignas(64) float scratch[MIX_CHUNK_ELEMS*2];
+  const auto *src = (const char *)srcBuff;
+  auto *dst = (char *)dstBuff;
+  const size_t sourceSize = formatToSize(_sourceFormat);
+  const size_t targetSize = formatToSize(_targetFormat);
+
+  for (size_t offset = 0; offset < numElems; offset += MIX_CHUNK_ELEMS)
+    {
+      const size_t n = std::min(MIX_CHUNK_ELEMS, numElems-offset);
+      const void *in = src+offset*sourceSize;
+      float *mixed = _outPlan.isValid()?scratch:(float *)(dst+offset*targetSize);
+      if (_inPlan.isValid())
+        {
+          _inPlan.execute(in, mixed, n);
+          in = mixed;
+        }
+      _mix(in, mixed, n, _factor, _phase, _frequency);
+      if (_outPlan.isValid()) _outPlan.execute(mixed, dst+offset*targetSize, n);
+      this->setPhase(_phase + n*_frequency);
+    }
+}
+
+void SoapySDR::ConverterMixer::setFrequency(const double frequency)
+{
+  _frequency = frequency;
+}
+
+double SoapySDR::ConverterMixer::getFrequency(void) const
+{
+  return _frequency;
+}
+
+void SoapySDR::ConverterMixer::setPhase(const double phase)
+{
+  _phase = phase - std::floor(phase);
+  if (_phase >= 1.0) _phase = 0.0;
+}
+
+double SoapySDR::ConverterMixer::getPhase(void) const
+{
+  return _phase;
+}
+
+const std::string &SoapySDR::ConverterMixer::getSourceFormat(void) const
+{
+  return _sourceFormat;
+}
+
+const std::string &SoapySDR::ConverterMixer::getTargetFormat(void) const
+{
+  return _targetFormat;
+}
+
+double SoapySDR::ConverterMixer::getScaler(void) const
+{
+  return _scaler;
+}
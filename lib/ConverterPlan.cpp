@@ -0,0 +1,331 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/ConverterPlan.hpp>
+#include <SoapySDR/Formats.hpp>
+#include "ConverterThreadPool.hpp"
+#include <stdexcept>
+#include <algorithm>
+#include <cstdlib>
+#include <cmath>
+#include <mutex>
+
+void accumulateConverterStats(const float *values, const size_t numElems, const size_t depth, const float scale, const float clipLevel, SoapySDR::ConverterStats &stats);
+
+//bytes of input plus output below which parallel execution stays on the caller
+static const size_t PARALLEL_THRESHOLD_BYTES = 1 << 20;
+
+//bytes of input plus output per chunk, sized to stay resident in a per-core L2 cache
+static const size_t PARALLEL_CHUNK_BYTES = 1 << 18;
+
+//bytes of each scratch buffer between the hops of a chain, two fit in L1 cache
+static const size_t CHAIN_SCRATCH_BYTES = 1 << 13;
+
+//elements per chunk when accumulating statistics, the CF32 values of a chunk fit in L1 cache
+static const size_t STATS_CHUNK_ELEMS = 1 << 10;
+
+//which CF32 or F32 buffer the statistics read
+enum StatsSide
+{
+  STATS_NONE,
+  STATS_TARGET,
+  STATS_SOURCE,
+  STATS_CONVERTED
+};
+
+SoapySDR::ConverterPlan::StatsSetup::StatsSetup(void):
+  once(new std::once_flag()),
+  side(STATS_NONE),
+  depth(0),
+  clipLevel(1.0f)
+{
+  return;
+}
+
+SoapySDR::ConverterPlan::StatsSetup::StatsSetup(const StatsSetup &):
+  StatsSetup()
+{
+  return;
+}
+
+SoapySDR::ConverterPlan::StatsSetup &SoapySDR::ConverterPlan::StatsSetup::operator=(const StatsSetup &)
+{
+  once.reset(new std::once_flag());
+  plan.reset();
+  side = STATS_NONE;
+  depth = 0;
+  clipLevel = 1.0f;
+  return *this;
+}
+
+SoapySDR::ConverterPlan::ConverterPlan(void):
+  _chunkElems(0),
+  _priority(ConverterRegistry::GENERIC),
+  _function(nullptr),
+  _scaler(1.0),
+  _sourceSize(0),
+  _targetSize(0),
+  _inPlace(false)
+{
+  return;
+}
+
+//is the format real or complex floating point, such as F32 or CF64?
+static bool isFloatFormat(const std::string &format)
+{
+  const size_t pos = (not format.empty() and format[0] == 'C')?1:0;
+  return format.size() > pos and format[pos] == 'F';
+}
+
+SoapySDR::ConverterPlan::ConverterPlan(const std::string &sourceFormat, const std::string &targetFormat, const double scaler):
+  _chunkElems(0),
+  _sourceFormat(sourceFormat),
+  _targetFormat(targetFormat),
+  _priority(ConverterRegistry::CUSTOM),
+  _function(nullptr),
+  _scaler(scaler),
+  _sourceSize(formatToSize(sourceFormat)),
+  _targetSize(formatToSize(targetFormat)),
+  _inPlace(false)
+{
+  const bool direct = not ConverterRegistry::listPriorities(sourceFormat, targetFormat).empty();
+  const auto path = direct?std::vector<std::string>{sourceFormat, targetFormat}:ConverterRegistry::findPath(sourceFormat, targetFormat);
+  if (path.empty())
+    {
+      throw std::runtime_error("ConverterPlan() no conversion path; "
+                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
+    }
+
+  //apply the scaler once, on the first hop to or from floating point
+  //where it cannot overflow an integer intermediate, or else on the last hop
+  size_t scaledHop = path.size()-2;
+  for (size_t i = 0; i+1 < path.size(); i++)
+    {
+      if (not isFloatFormat(path[i]) and not isFloatFormat(path[i+1])) continue;
+      scaledHop = i;
+      break;
+    }
+
+  size_t scratchSize = 1;
+  for (size_t i = 0; i+1 < path.size(); i++)
+    {
+      const auto hopPriority = ConverterRegistry::getSelectedPriority(path[i], path[i+1]);
+      Hop hop;
+      hop.targetFormat = path[i+1];
+      hop.function = ConverterRegistry::getFunction(path[i], path[i+1], hopPriority);
+      hop.scaler = (i == scaledHop)?scaler:1.0;
+      hop.targetSize = formatToSize(path[i+1]);
+      _hops.push_back(hop);
+      _priority = std::min(_priority, hopPriority);
+      if (i+2 < path.size()) scratchSize = std::max(scratchSize, hop.targetSize);
+    }
+
+  if (_hops.size() == 1) _function = _hops.front().function;
+  _inPlace = (_hops.size() == 1)?
+    ConverterRegistry::supportsInPlace(sourceFormat, targetFormat, _priority):
+    (_targetSize != 0 and _targetSize <= _sourceSize);
+
+  //whole multiples of 64 elements per chunk keep the vector kernels on their full-width loops
+  _chunkElems = CHAIN_SCRATCH_BYTES/scratchSize;
+  if (_chunkElems >= 64) _chunkElems &= ~size_t(63);
+}
+
+SoapySDR::ConverterPlan::ConverterPlan(const std::string &sourceFormat, const std::string &targetFormat, const ConverterRegistry::FunctionPriority &priority, const double scaler):
+  _chunkElems(0),
+  _sourceFormat(sourceFormat),
+  _targetFormat(targetFormat),
+  _priority(priority),
+  _function(ConverterRegistry::getFunction(sourceFormat, targetFormat, priority)),
+  _scaler(scaler),
+  _sourceSize(formatToSize(sourceFormat)),
+  _targetSize(formatToSize(targetFormat)),
+  _inPlace(ConverterRegistry::supportsInPlace(sourceFormat, targetFormat, priority))
+{
+  Hop hop;
+  hop.targetFormat = targetFormat;
+  hop.function = _function;
+  hop.scaler = scaler;
+  hop.targetSize = _targetSize;
+  _hops.push_back(hop);
+}
+
+//the normalized value of the largest positive code of an integer format, 1.0 for other formats
+static float formatClipLevel(const std::string &format)
+{
+  const size_t pos = (not format.empty() and format[0] == 'C')?1:0;
+  if (format.size() <= pos or (format[pos] != 'S' and format[pos] != 'U')) return 1.0f;
+  const int bits = std::atoi(format.c_str()+pos+1);
+  if (bits < 2) return 1.0f;
+  const double fullScale = std::ldexp(1.0, bits-1);
+  return float((fullScale-1)/fullScale);
+}
+
+/*!
+ * Resolve how the statistics are measured, once per plan.
+ * Converting the target back to floating point needs a path search and a plan,
+ * which plans that never measure statistics should not pay for.
+ */
+void SoapySDR::ConverterPlan::prepareStats(void) const
+{
+  const bool complex = not _sourceFormat.empty() and _sourceFormat[0] == 'C';
+  const std::string floatFormat = complex?SOAPY_SDR_CF32:SOAPY_SDR_F32;
+  _stats.depth = complex?2:1;
+
+  if (_targetFormat == floatFormat)
+    {
+      _stats.side = STATS_TARGET;
+      _stats.clipLevel = float(formatClipLevel(_sourceFormat)*std::abs(_scaler));
+    }
+  else if (_sourceFormat == floatFormat)
+    {
+      _stats.side = STATS_SOURCE;
+      _stats.clipLevel = formatClipLevel(_targetFormat);
+    }
+  else if (not ConverterRegistry::findPath(_targetFormat, floatFormat).empty())
+    {
+      _stats.side = STATS_CONVERTED;
+      _stats.plan.reset(new ConverterPlan(_targetFormat, floatFormat));
+      _stats.clipLevel = formatClipLevel(_targetFormat);
+    }
+}
+
+bool SoapySDR::ConverterPlan::isValid(void) const
+{
+  return not _hops.empty();
+}
+
+void SoapySDR::ConverterPlan::execute(const void *srcBuff, void *dstBuff, const size_t numElems) const
+{
+  if (_function != nullptr) _function(srcBuff, dstBuff, numElems, _scaler);
+  else this->executeChain(srcBuff, dstBuff, numElems);
+}
+
+void SoapySDR::ConverterPlan::execute(const void *srcBuff, void *dstBuff, const size_t numElems, ConverterStats &stats) const
+{
+  std::call_once(*_stats.once, &ConverterPlan::prepareStats, this);
+  if (_stats.side == STATS_NONE)
+    {
+      throw std::runtime_error("ConverterPlan::execute() no statistics for this conversion; "
+                               "sourceFormat="+_sourceFormat+", targetFormat="+_targetFormat);
+    }
+
+  alignas(64) float scratch[STATS_CHUNK_ELEMS*2];
+  const auto *src = (const char *)srcBuff;
+  auto *dst = (char *)dstBuff;
+
+  for (size_t offset = 0; offset < numElems; offset += STATS_CHUNK_ELEMS)
+    {
+      const size_t n = std::min(STATS_CHUNK_ELEMS, numElems-offset);
+      const void *in = src+offset*_sourceSize;
+      void *out = dst+offset*_targetSize;
+      //read the source before an in-place conversion overwrites it
+      if (_stats.side == STATS_SOURCE) accumulateConverterStats((const float *)in, n, _stats.depth, float(_scaler), _stats.clipLevel, stats);
+      this->execute(in, out, n);
+      if (_stats.side == STATS_TARGET) accumulateConverterStats((const float *)out, n, _stats.depth, 1.0f, _stats.clipLevel, stats);
+      if (_stats.side == STATS_CONVERTED)
+        {
+          _stats.plan->execute(out, scratch, n);
+          accumulateConverterStats(scratch, n, _stats.depth, 1.0f, _stats.clipLevel, stats);
+        }
+    }
+}
+
+void SoapySDR::ConverterPlan::executeChain(const void *srcBuff, void *dstBuff, const size_t numElems) const
+{
+  alignas(64) char scratch[2][CHAIN_SCRATCH_BYTES];
+  const auto *src = (const char *)srcBuff;
+  auto *dst = (char *)dstBuff;
+
+  for (size_t offset = 0; offset < numElems; offset += _chunkElems)
+    {
+      const size_t n = std::min(_chunkElems, numElems-offset);
+      const void *in = src+offset*_sourceSize;
+      for (size_t i = 0; i < _hops.size(); i++)
+        {
+          void *out = (i+1 == _hops.size())?(dst+offset*_targetSize):scratch[i%2];
+          _hops[i].function(in, out, n, _hops[i].scaler);
+          in = out;
+        }
+    }
+}
+
+void SoapySDR::ConverterPlan::executeParallel(const void *srcBuff, void *dstBuff, const size_t numElems, const size_t numThreads) const
+{
+  const size_t elemBytes = _sourceSize + _targetSize;
+  const size_t threads = (numThreads == 0)?converterMaxThreads():numThreads;
+  //in place, a narrowing chunk overwrites source bytes of earlier chunks that may not be converted yet
+  const bool aliased = srcBuff == dstBuff and _targetSize != _sourceSize;
+  if (threads <= 1 or aliased or numElems*elemBytes < PARALLEL_THRESHOLD_BYTES)
+    {
+      return this->execute(srcBuff, dstBuff, numElems);
+    }
+
+  //keep chunk boundaries on a multiple of 64 elements for the vector kernels
+  const size_t chunkElems = std::max<size_t>(64, (PARALLEL_CHUNK_BYTES/elemBytes) & ~size_t(63));
+  const size_t numChunks = (numElems + chunkElems - 1)/chunkElems;
+
+  const auto *src = (const char *)srcBuff;
+  auto *dst = (char *)dstBuff;
+  converterParallelFor(numChunks, threads, [&](const size_t chunk)
+  {
+    const size_t offset = chunk*chunkElems;
+    const size_t n = std::min(chunkElems, numElems-offset);
+    this->execute(src+offset*_sourceSize, dst+offset*_targetSize, n);
+  });
+}
+
+void SoapySDR::ConverterPlan::executeBatch(const void * const *srcBuffs, void * const *dstBuffs, const size_t numBuffs, const size_t numElems) const
+{
+  for (size_t i = 0; i < numBuffs; i++)
+    {
+      this->execute(srcBuffs[i], dstBuffs[i], numElems);
+    }
+}
+
+const std::string &SoapySDR::ConverterPlan::getSourceFormat(void) const
+{
+  return _sourceFormat;
+}
+
+const std::string &SoapySDR::ConverterPlan::getTargetFormat(void) const
+{
+  return _targetFormat;
+}
+
+SoapySDR::ConverterRegistry::FunctionPriority SoapySDR::ConverterPlan::getPriority(void) const
+{
+  return _priority;
+}
+
+SoapySDR::ConverterRegistry::ConverterFunction SoapySDR::ConverterPlan::getFunction(void) const
+{
+  return _function;
+}
+
+bool SoapySDR::ConverterPlan::supportsInPlace(void) const
+{
+  return _inPlace;
+}
+
+std::vector<std::string> SoapySDR::ConverterPlan::getPath(void) const
+{
+  std::vector<std::string> path;
+  if (_hops.empty()) return path;
+  path.push_back(_sourceFormat);
+  for (const auto &hop : _hops) path.push_back(hop.targetFormat);
+  return path;
+}
+
+double SoapySDR::ConverterPlan::getScaler(void) const
+{
+  return _scaler;
+}
+
+size_t SoapySDR::ConverterPlan::getSourceSize(void) const
+{
+  return _sourceSize;
+}
+
+size_t SoapySDR::ConverterPlan::getTargetSize(void) const
+{
+  return _targetSize;
+}
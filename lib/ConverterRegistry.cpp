@@ -2,41 +2,283 @@
 // Copyright (c) 2018-2018 Josh Blum
 // SPDX-License-Identifier: BSL-1.0
 
+#include "SnapshotRegistry.hpp"
 #include <SoapySDR/ConverterRegistry.hpp>
 #include <algorithm>
 #include <stdexcept>
+#include <set>
+#include <iterator>
 
 void lateLoadDefaultConverters(void);
+bool autotuneFromEnvironment(void);
 
-static SoapySDR::ConverterRegistry::FormatConverters formatConverters;
+/***********************************************************************
+ * Registry storage
+ *
+ * The tables live in a copy-on-write snapshot, see SnapshotRegistry.
+ **********************************************************************/
+/*!
+ * The autotuned priority of a source/target pair, with the priorities
+ * that were registered when it was tuned. The choice only holds while
+ * the same priorities are registered, so that a converter registered
+ * later, such as a module's CUSTOM converter, takes precedence.
+ */
+struct TunedPriority
+{
+  SoapySDR::ConverterRegistry::FunctionPriority priority;
+  std::vector<SoapySDR::ConverterRegistry::FunctionPriority> priorities;
+};
 
-SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converterFunction)
+struct RegistrySnapshot
 {
-  if (formatConverters.count(sourceFormat) == 0)
-    ;
-  else if (formatConverters[sourceFormat].count(targetFormat) == 0)
+  SoapySDR::ConverterRegistry::FormatConverters converters;
+
+  //CPU feature mask of each registered source/target/priority entry
+  std::map<std::string, std::map<std::string, std::map<SoapySDR::ConverterRegistry::FunctionPriority, int>>> features;
+
+  //autotuned priority of a source/target pair, used instead of the highest priority
+  std::map<std::string, std::map<std::string, TunedPriority>> tuned;
+
+  //entries that accept the same buffer as input and output
+  std::map<std::string, std::map<std::string, std::map<SoapySDR::ConverterRegistry::FunctionPriority, bool>>> inPlace;
+
+  //rounding and saturating variants of the float to integer converters
+  SoapySDR::ConverterRegistry::FormatConverters saturating;
+  std::map<std::string, std::map<std::string, std::map<SoapySDR::ConverterRegistry::FunctionPriority, int>>> saturatingFeatures;
+};
+
+//leaked, since converters may be looked up during static destruction
+static SnapshotRegistry<RegistrySnapshot> &registry(void)
+{
+  static auto *instance = new SnapshotRegistry<RegistrySnapshot>();
+  return *instance;
+}
+
+//set while the library registers its own converters, see setDefaultConverterRegistration()
+static bool defaultRegistration(false);
+
+/*!
+ * Open a registration batch on the calling thread.
+ * Other writers block until the matching endConverterRegistration().
+ */
+void beginConverterRegistration(void)
+{
+  registry().begin();
+}
+
+//! Close a registration batch and publish its registrations
+void endConverterRegistration(void)
+{
+  registry().end();
+}
+
+typedef std::map<std::string, std::map<std::string, std::map<SoapySDR::ConverterRegistry::FunctionPriority, int>>> FeatureTable;
+
+/*!
+ * Mark the registrations of the open batch as the library's own converters.
+ * Every default converter whose target element is no larger than its source
+ * element is written to work in place, so those are recorded as in-place capable.
+ */
+void setDefaultConverterRegistration(const bool isDefault)
+{
+  defaultRegistration = isDefault;
+}
+
+static const int *findFeatures(const FeatureTable &features, const std::string &sourceFormat, const std::string &targetFormat, const SoapySDR::ConverterRegistry::FunctionPriority priority)
+{
+  const auto source = features.find(sourceFormat);
+  if (source == features.end()) return nullptr;
+  const auto target = source->second.find(targetFormat);
+  if (target == source->second.end()) return nullptr;
+  const auto entry = target->second.find(priority);
+  if (entry == target->second.end()) return nullptr;
+  return &entry->second;
+}
+
+//the autotuned priority while the tuned priorities are registered, otherwise the highest priority
+static SoapySDR::ConverterRegistry::TargetFormatConverterPriority::const_iterator selectConverter(const RegistrySnapshot &snapshot, const std::string &sourceFormat, const std::string &targetFormat, const SoapySDR::ConverterRegistry::TargetFormatConverterPriority &functions)
+{
+  const auto source = snapshot.tuned.find(sourceFormat);
+  if (source != snapshot.tuned.end())
+    {
+      const auto target = source->second.find(targetFormat);
+      if (target != source->second.end() and target->second.priorities.size() == functions.size() and
+        std::equal(functions.begin(), functions.end(), target->second.priorities.begin(),
+          [](const SoapySDR::ConverterRegistry::TargetFormatConverterPriority::value_type &entry, const SoapySDR::ConverterRegistry::FunctionPriority priority)
+          {
+            return entry.first == priority;
+          }))
+        {
+          return functions.find(target->second.priority);
+        }
+    }
+  return std::prev(functions.end());
+}
+
+/*!
+ * Record the autotuned priority of a source/target pair,
+ * chosen among the given registered priorities in ascending order.
+ */
+void setTunedConverterPriority(const std::string &sourceFormat, const std::string &targetFormat, const SoapySDR::ConverterRegistry::FunctionPriority priority, const std::vector<SoapySDR::ConverterRegistry::FunctionPriority> &priorities)
+{
+  if (std::find(priorities.begin(), priorities.end(), priority) == priorities.end()) return;
+  TunedPriority &tuned = registry().begin().tuned[sourceFormat][targetFormat];
+  tuned.priority = priority;
+  tuned.priorities = priorities;
+  registry().markModified();
+  registry().end();
+}
+
+/*!
+ * Load the default converters, then run the autotuner once
+ * when requested by the environment. Lookups made by the autotuner itself
+ * return early here rather than recursing into the autotuner.
+ */
+static void lateLoadConverters(void)
+{
+  lateLoadDefaultConverters();
+
+  static thread_local bool tuning = false;
+  if (tuning) return;
+  tuning = true;
+  static const bool tuned = autotuneFromEnvironment();
+  (void)tuned;
+  tuning = false;
+}
+
+SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converterFunction):
+  ConverterRegistry(sourceFormat, targetFormat, priority, converterFunction, 0)
+{
+  return;
+}
+
+//the CPU features from the least to the most capable, see ConverterRegistry::CPUFeature
+static const int featureRanking[] = {
+  SoapySDR::ConverterRegistry::CPU_SSE2,
+  SoapySDR::ConverterRegistry::CPU_SSSE3,
+  SoapySDR::ConverterRegistry::CPU_SSE41,
+  SoapySDR::ConverterRegistry::CPU_AVX,
+  SoapySDR::ConverterRegistry::CPU_F16C,
+  SoapySDR::ConverterRegistry::CPU_FMA,
+  SoapySDR::ConverterRegistry::CPU_AVX2,
+  SoapySDR::ConverterRegistry::CPU_AVX512F,
+  SoapySDR::ConverterRegistry::CPU_AVX512BW,
+};
+
+//the rank of the most capable feature in the mask, 0 for a generic kernel
+static size_t featureRank(const int cpuFeatures)
+{
+  size_t rank = 0;
+  for (size_t i = 0; i < sizeof(featureRanking)/sizeof(featureRanking[0]); i++)
+    {
+      if ((cpuFeatures & featureRanking[i]) != 0) rank = i+1;
+    }
+  return rank;
+}
+
+static size_t featureCount(const int cpuFeatures)
+{
+  size_t count = 0;
+  for (int mask = cpuFeatures; mask != 0; mask &= mask-1) count++;
+  return count;
+}
+
+/*!
+ * Order the kernels for one entry: the rank of the most capable feature first,
+ * then the number of features, and the mask value only to break the last tie.
+ * Also used by the ChannelConverterRegistry.
+ */
+bool moreCapableFeatures(const int cpuFeatures, const int otherFeatures)
+{
+  const size_t rank = featureRank(cpuFeatures), otherRank = featureRank(otherFeatures);
+  if (rank != otherRank) return rank > otherRank;
+  const size_t count = featureCount(cpuFeatures), otherCount = featureCount(otherFeatures);
+  if (count != otherCount) return count > otherCount;
+  return cpuFeatures > otherFeatures;
+}
+
+/*!
+ * Add a converter to one of the snapshot tables.
+ * Converters that need missing CPU features are skipped, and among converters
+ * for the same entry the most capable one that this host supports is kept.
+ */
+static void registerConverter(
+  SoapySDR::ConverterRegistry::FormatConverters RegistrySnapshot::*converters,
+  FeatureTable RegistrySnapshot::*features,
+  std::map<std::string, std::map<std::string, std::map<SoapySDR::ConverterRegistry::FunctionPriority, bool>>> RegistrySnapshot::*inPlace,
+  const char *what,
+  const std::string &sourceFormat,
+  const std::string &targetFormat,
+  const SoapySDR::ConverterRegistry::FunctionPriority priority,
+  SoapySDR::ConverterRegistry::ConverterFunction converterFunction,
+  const int cpuFeatures,
+  const bool inPlaceCapable)
+{
+  if ((cpuFeatures & SoapySDR::ConverterRegistry::getCPUFeatures()) != cpuFeatures)
+    {
+      SoapySDR::logf(SOAPY_SDR_DEBUG, "SoapySDR::%s(%s, %s, %s) skipped, CPU features 0x%x not supported", what, sourceFormat.c_str(), targetFormat.c_str(), std::to_string(priority).c_str(), cpuFeatures);
+      return;
+    }
+
+  RegistrySnapshot &pending = registry().begin();
+  const int *existingFeatures = findFeatures(pending.*features, sourceFormat, targetFormat, priority);
+  if (existingFeatures == nullptr)
     ;
-  else if (formatConverters[sourceFormat][targetFormat].count(priority) != 0)
+  else if (*existingFeatures == cpuFeatures)
     {
-      SoapySDR::logf(SOAPY_SDR_ERROR, "SoapySDR::ConverterRegistry(%s, %s, %s) duplicate registration", sourceFormat.c_str(), targetFormat.c_str(), std::to_string(priority).c_str());
+      SoapySDR::logf(SOAPY_SDR_ERROR, "SoapySDR::%s(%s, %s, %s) duplicate registration", what, sourceFormat.c_str(), targetFormat.c_str(), std::to_string(priority).c_str());
+      registry().end();
       return;
     }
-  
-  formatConverters[sourceFormat][targetFormat][priority] = converterFunction;
 
+  if (existingFeatures == nullptr or moreCapableFeatures(cpuFeatures, *existingFeatures))
+    {
+      (pending.*converters)[sourceFormat][targetFormat][priority] = converterFunction;
+      (pending.*features)[sourceFormat][targetFormat][priority] = cpuFeatures;
+      if (inPlace != nullptr)
+        {
+          const size_t sourceSize = SoapySDR::formatToSize(sourceFormat);
+          const size_t targetSize = SoapySDR::formatToSize(targetFormat);
+          const bool defaultInPlace = defaultRegistration and targetSize != 0 and targetSize <= sourceSize;
+          (pending.*inPlace)[sourceFormat][targetFormat][priority] = inPlaceCapable or defaultInPlace;
+        }
+      registry().markModified();
+    }
+
+  registry().end();
+}
+
+SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converterFunction, const int cpuFeatures):
+  ConverterRegistry(sourceFormat, targetFormat, priority, converterFunction, cpuFeatures, false)
+{
   return;
 }
 
+SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converterFunction, const int cpuFeatures, const bool inPlace)
+{
+  registerConverter(&RegistrySnapshot::converters, &RegistrySnapshot::features, &RegistrySnapshot::inPlace, "ConverterRegistry",
+    sourceFormat, targetFormat, priority, converterFunction, cpuFeatures, inPlace);
+}
+
+void SoapySDR::ConverterRegistry::registerSaturatingFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converter, const int cpuFeatures)
+{
+  registerConverter(&RegistrySnapshot::saturating, &RegistrySnapshot::saturatingFeatures, nullptr, "ConverterRegistry::registerSaturatingFunction",
+    sourceFormat, targetFormat, priority, converter, cpuFeatures, false);
+}
+
 std::vector<std::string> SoapySDR::ConverterRegistry::listTargetFormats(const std::string &sourceFormat)
 {
-  lateLoadDefaultConverters();
+  lateLoadConverters();
+  const auto snapshot = registry().read();
+  const auto &formatConverters = snapshot->converters;
 
   std::vector<std::string> targets;
 
-  if (formatConverters.count(sourceFormat) == 0)
+  const auto source = formatConverters.find(sourceFormat);
+  if (source == formatConverters.end())
     return targets;
 
-  for(const auto &it:formatConverters[sourceFormat])
+  for(const auto &it:source->second)
     {
       std::string targetFormat = it.first;
       targets.push_back(targetFormat);
@@ -48,14 +290,16 @@ std::vector<std::string> SoapySDR::ConverterRegistry::listTargetFormats(const st
 
 std::vector<std::string> SoapySDR::ConverterRegistry::listSourceFormats(const std::string &targetFormat)
 {
-  lateLoadDefaultConverters();
+  lateLoadConverters();
+  const auto snapshot = registry().read();
+  const auto &formatConverters = snapshot->converters;
 
   std::vector<std::string> sources;
 
   for(const auto &it:formatConverters)
     {
       std::string sourceFormat = it.first;
-      if (formatConverters[sourceFormat].count(targetFormat) > 0)
+      if (it.second.count(targetFormat) > 0)
         sources.push_back(sourceFormat);
     }
   
@@ -65,23 +309,24 @@ std::vector<std::string> SoapySDR::ConverterRegistry::listSourceFormats(const st
 
 std::vector<SoapySDR::ConverterRegistry::FunctionPriority> SoapySDR::ConverterRegistry::listPriorities(const std::string &sourceFormat, const std::string &targetFormat)
 {
-  lateLoadDefaultConverters();
+  lateLoadConverters();
+  const auto snapshot = registry().read();
+  const auto &formatConverters = snapshot->converters;
 
   std::vector<FunctionPriority> priorities;
   
-  if (formatConverters.count(sourceFormat) == 0)
-    ;
-  else if (formatConverters[sourceFormat].count(targetFormat) == 0)
-    ;
-  else if (formatConverters[sourceFormat][targetFormat].size() == 0)
-    ;
-  else
+  const auto source = formatConverters.find(sourceFormat);
+  if (source == formatConverters.end())
+    return priorities;
+
+  const auto target = source->second.find(targetFormat);
+  if (target == source->second.end())
+    return priorities;
+
+  for(const auto &it:target->second)
     {
-      for(const auto &it:formatConverters[sourceFormat][targetFormat])
-        {
-          FunctionPriority priority = it.first;
-          priorities.push_back(priority);
-        }
+      FunctionPriority priority = it.first;
+      priorities.push_back(priority);
     }
   
   return priorities;
@@ -90,57 +335,156 @@ std::vector<SoapySDR::ConverterRegistry::FunctionPriority> SoapySDR::ConverterRe
 
 SoapySDR::ConverterRegistry::ConverterFunction SoapySDR::ConverterRegistry::getFunction(const std::string &sourceFormat, const std::string &targetFormat)
 {
-  lateLoadDefaultConverters();
+  lateLoadConverters();
+  const auto reader = registry().read();
+  const auto &snapshot = *reader;
+  const auto &formatConverters = snapshot.converters;
 
-  if (formatConverters.count(sourceFormat) == 0)
+  const auto source = formatConverters.find(sourceFormat);
+  if (source == formatConverters.end())
     {
       throw std::runtime_error("ConverterRegistry::getFunction() conversion source not registered; "
                                "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
     }
   
-  if (formatConverters[sourceFormat].count(targetFormat) == 0)
+  const auto target = source->second.find(targetFormat);
+  if (target == source->second.end())
     {
       throw std::runtime_error("ConverterRegistry::getFunction() conversion target not registered; "
                                "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
     }
 
-  if (formatConverters[sourceFormat][targetFormat].size() == 0)
+  if (target->second.size() == 0)
     {
       throw std::runtime_error("ConverterRegistry::getFunction() no functions found for registered conversion; "
                                "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
     }
 
-  return formatConverters[sourceFormat][targetFormat].rbegin()->second;
+  return selectConverter(snapshot, sourceFormat, targetFormat, target->second)->second;
+}
+
+SoapySDR::ConverterRegistry::FunctionPriority SoapySDR::ConverterRegistry::getSelectedPriority(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  lateLoadConverters();
+  const auto reader = registry().read();
+  const auto &snapshot = *reader;
+  const auto &formatConverters = snapshot.converters;
+
+  const auto source = formatConverters.find(sourceFormat);
+  if (source != formatConverters.end())
+    {
+      const auto target = source->second.find(targetFormat);
+      if (target != source->second.end() and not target->second.empty())
+        {
+          return selectConverter(snapshot, sourceFormat, targetFormat, target->second)->first;
+        }
+    }
+
+  throw std::runtime_error("ConverterRegistry::getSelectedPriority() conversion not registered; "
+                           "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
 }
 
 SoapySDR::ConverterRegistry::ConverterFunction SoapySDR::ConverterRegistry::getFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority)
 {
-  lateLoadDefaultConverters();
+  lateLoadConverters();
+  const auto snapshot = registry().read();
+  const auto &formatConverters = snapshot->converters;
 
-  if (formatConverters.count(sourceFormat) == 0)
+  const auto source = formatConverters.find(sourceFormat);
+  if (source == formatConverters.end())
     {
       throw std::runtime_error("ConverterRegistry::getFunction() conversion source not registered; "
                                "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", priority="+std::to_string(priority));
     }
 
-  if (formatConverters[sourceFormat].count(targetFormat) == 0)
+  const auto target = source->second.find(targetFormat);
+  if (target == source->second.end())
     {
       throw std::runtime_error("ConverterRegistry::getFunction() conversion target not registered; "
                                "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", priority="+std::to_string(priority));
     }
 
-  if (formatConverters[sourceFormat][targetFormat].count(priority) == 0)
+  const auto function = target->second.find(priority);
+  if (function == target->second.end())
     {
       throw std::runtime_error("ConverterRegistry::getFunction() conversion priority not registered; "
                                "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", priority="+std::to_string(priority));
     }
 
-  return formatConverters[sourceFormat][targetFormat][priority];
+  return function->second;
+}
+
+bool SoapySDR::ConverterRegistry::supportsInPlace(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  return supportsInPlace(sourceFormat, targetFormat, getSelectedPriority(sourceFormat, targetFormat));
+}
+
+bool SoapySDR::ConverterRegistry::supportsInPlace(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority)
+{
+  lateLoadConverters();
+  const auto snapshot = registry().read();
+  const auto &inPlace = snapshot->inPlace;
+
+  const auto source = inPlace.find(sourceFormat);
+  if (source == inPlace.end()) return false;
+  const auto target = source->second.find(targetFormat);
+  if (target == source->second.end()) return false;
+  const auto entry = target->second.find(priority);
+  return entry != target->second.end() and entry->second;
+}
+
+int SoapySDR::ConverterRegistry::getRequiredCPUFeatures(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority)
+{
+  lateLoadConverters();
+  const auto snapshot = registry().read();
+  const int *features = findFeatures(snapshot->features, sourceFormat, targetFormat, priority);
+  if (features == nullptr)
+    {
+      throw std::runtime_error("ConverterRegistry::getRequiredCPUFeatures() conversion priority not registered; "
+                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", priority="+std::to_string(priority));
+    }
+  return *features;
+}
+
+SoapySDR::ConverterRegistry::ConverterFunction SoapySDR::ConverterRegistry::getSaturatingFunction(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  lateLoadConverters();
+  const auto snapshot = registry().read();
+  const auto &saturating = snapshot->saturating;
+
+  const auto source = saturating.find(sourceFormat);
+  if (source != saturating.end())
+    {
+      const auto target = source->second.find(targetFormat);
+      if (target != source->second.end() and not target->second.empty()) return target->second.rbegin()->second;
+    }
+
+  throw std::runtime_error("ConverterRegistry::getSaturatingFunction() conversion not registered; "
+                           "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
+}
+
+SoapySDR::ConverterRegistry::ConverterFunction SoapySDR::ConverterRegistry::getSaturatingFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority)
+{
+  lateLoadConverters();
+  const auto snapshot = registry().read();
+  const auto &saturating = snapshot->saturating;
+
+  const auto source = saturating.find(sourceFormat);
+  if (source != saturating.end())
+    {
+      const auto target = source->second.find(targetFormat);
+      if (target != source->second.end() and target->second.count(priority) != 0) return target->second.at(priority);
+    }
+
+  throw std::runtime_error("ConverterRegistry::getSaturatingFunction() conversion priority not registered; "
+                           "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", priority="+std::to_string(priority));
 }
 
 std::vector<std::string> SoapySDR::ConverterRegistry::listAvailableSourceFormats(void)
 {
-    lateLoadDefaultConverters();
+    lateLoadConverters();
+    const auto snapshot = registry().read();
+    const auto &formatConverters = snapshot->converters;
 
     std::vector<std::string> sources;
     for (const auto &it : formatConverters)
@@ -153,3 +497,66 @@ std::vector<std::string> SoapySDR::ConverterRegistry::listAvailableSourceFormats
     std::sort(sources.begin(), sources.end());
     return sources;
 }
+
+std::vector<std::string> SoapySDR::ConverterRegistry::findPath(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  lateLoadConverters();
+  const auto reader = registry().read();
+  const auto &snapshot = *reader;
+  const auto &formatConverters = snapshot.converters;
+
+  //dijkstra over formats, the graph is a few dozen nodes
+  std::map<std::string, size_t> cost;
+  std::map<std::string, std::string> previous;
+  std::set<std::pair<size_t, std::string>> frontier;
+  cost[sourceFormat] = 0;
+  frontier.insert(std::make_pair(0, sourceFormat));
+
+  while (not frontier.empty())
+    {
+      const auto node = *frontier.begin();
+      frontier.erase(frontier.begin());
+      if (node.second == targetFormat) break;
+      if (node.first != cost[node.second]) continue;
+
+      //the source is sized by the caller, intermediates must have a known size
+      const size_t nodeSize = formatToSize(node.second);
+      if (node.second != sourceFormat and nodeSize == 0) continue;
+
+      const auto source = formatConverters.find(node.second);
+      if (source == formatConverters.end()) continue;
+      for (const auto &target : source->second)
+        {
+          if (target.second.empty()) continue;
+          const FunctionPriority priority = selectConverter(snapshot, node.second, target.first, target.second)->first;
+          const size_t weight = size_t(CUSTOM) + 3 - size_t(std::min(priority, CUSTOM));
+          const size_t hopCost = (nodeSize + formatToSize(target.first) + 1)*weight;
+          const size_t total = node.first + hopCost;
+          const auto it = cost.find(target.first);
+          if (it != cost.end() and it->second <= total) continue;
+          cost[target.first] = total;
+          previous[target.first] = node.second;
+          frontier.insert(std::make_pair(total, target.first));
+        }
+    }
+
+  std::vector<std::string> path;
+  if (sourceFormat == targetFormat)
+    {
+      const auto source = formatConverters.find(sourceFormat);
+      if (source != formatConverters.end() and source->second.count(targetFormat) != 0)
+        {
+          path.push_back(sourceFormat);
+          path.push_back(targetFormat);
+        }
+      return path;
+    }
+  if (previous.count(targetFormat) == 0) return path;
+  for (std::string format = targetFormat; format != sourceFormat; format = previous[format])
+    {
+      path.push_back(format);
+    }
+  path.push_back(sourceFormat);
+  std::reverse(path.begin(), path.end());
+  return path;
+}
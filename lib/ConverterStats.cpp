@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/ConverterPlan.hpp>
+#include "VectorizedHelpers.hpp"
+#include <algorithm>
+#include <cmath>
+
+/***********************************************************************
+ * ConverterStats
+ **********************************************************************/
+
+SoapySDR::ConverterStats::ConverterStats(void)
+{
+  this->reset();
+}
+
+void SoapySDR::ConverterStats::reset(void)
+{
+  numElems = 0;
+  numClipped = 0;
+  peak = 0.0;
+  sumI = 0.0;
+  sumQ = 0.0;
+  sumPower = 0.0;
+}
+
+double SoapySDR::ConverterStats::rms(void) const
+{
+  return (numElems == 0)?0.0:std::sqrt(sumPower/numElems);
+}
+
+double SoapySDR::ConverterStats::meanI(void) const
+{
+  return (numElems == 0)?0.0:sumI/numElems;
+}
+
+double SoapySDR::ConverterStats::meanQ(void) const
+{
+  return (numElems == 0)?0.0:sumQ/numElems;
+}
+
+/***********************************************************************
+ * Accumulation kernels
+ *
+ * The kernels sum a chunk in float and the caller adds the chunk
+ * into the double precision counters, so chunks of a few thousand
+ * values keep the float sums accurate.
+ **********************************************************************/
+
+typedef void (*AccumulateFunction)(const float *, const size_t, const size_t, const float, const float, SoapySDR::ConverterStats &);
+
+static void genericAccumulate(const float *values, const size_t numElems, const size_t depth, const float scale, const float clipLevel, SoapySDR::ConverterStats &stats)
+{
+  float peak(0.0f), sumI(0.0f), sumQ(0.0f), sumPower(0.0f);
+  size_t clipped(0);
+  for (size_t i = 0; i < numElems; i++)
+    {
+      const float re = values[i*depth]*scale;
+      const float im = (depth == 2)?values[i*depth+1]*scale:0.0f;
+      const float mag = std::max(std::abs(re), std::abs(im));
+      peak = std::max(peak, mag);
+      sumI += re;
+      sumQ += im;
+      sumPower += re*re + im*im;
+      if (mag >= clipLevel) clipped++;
+    }
+  stats.peak = std::max<double>(stats.peak, peak);
+  stats.sumI += sumI;
+  stats.sumQ += sumQ;
+  stats.sumPower += sumPower;
+  stats.numClipped += clipped;
+  stats.numElems += numElems;
+}
+
+#ifdef SOAPY_SDR_CONVERTERS_X86
+
+//accumulators for one stream of 8 floats, two streams hide the add latency
+struct AvxAccumulators
+{
+  __m256 peak, sum, power, clipped;
+};
+
+SOAPY_SDR_TARGET("avx")
+static inline void avxAccumulate8(const __m256 in, const __m256 scale, const __m256 clipLevel, const __m256 clipWeights, const bool complex, AvxAccumulators &acc)
+{
+  const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+  const __m256 v = _mm256_mul_ps(in, scale);
+  const __m256 mag = _mm256_and_ps(v, absMask);
+  acc.peak = _mm256_max_ps(acc.peak, mag);
+  acc.sum = _mm256_add_ps(acc.sum, v);
+  acc.power = _mm256_add_ps(acc.power, _mm256_mul_ps(v, v));
+  //an element clips when either of its components does, counted once on its I lane
+  __m256 clip = _mm256_cmp_ps(mag, clipLevel, _CMP_GE_OQ);
+  if (complex) clip = _mm256_or_ps(clip, _mm256_permute_ps(clip, _MM_SHUFFLE(2, 3, 0, 1)));
+  acc.clipped = _mm256_add_ps(acc.clipped, _mm256_and_ps(clip, clipWeights));
+}
+
+SOAPY_SDR_TARGET("avx")
+static void avxAccumulate(const float *values, const size_t numElems, const size_t depth, const float scale, const float clipLevel, SoapySDR::ConverterStats &stats)
+{
+  const size_t n = numElems*depth;
+  const bool complex = depth == 2;
+  const __m256 s = _mm256_set1_ps(scale);
+  const __m256 clip = _mm256_set1_ps(clipLevel);
+  const __m256 weights = complex?_mm256_setr_ps(1, 0, 1, 0, 1, 0, 1, 0):_mm256_set1_ps(1);
+  AvxAccumulators acc[2];
+  for (auto &a : acc) a.peak = a.sum = a.power = a.clipped = _mm256_setzero_ps();
+
+  size_t i = 0;
+  for (; i+16 <= n; i += 16)
+    {
+      avxAccumulate8(_mm256_loadu_ps(values+i+0), s, clip, weights, complex, acc[0]);
+      avxAccumulate8(_mm256_loadu_ps(values+i+8), s, clip, weights, complex, acc[1]);
+    }
+
+  alignas(32) float lanes[4][8];
+  _mm256_store_ps(lanes[0], _mm256_max_ps(acc[0].peak, acc[1].peak));
+  _mm256_store_ps(lanes[1], _mm256_add_ps(acc[0].sum, acc[1].sum));
+  _mm256_store_ps(lanes[2], _mm256_add_ps(acc[0].power, acc[1].power));
+  _mm256_store_ps(lanes[3], _mm256_add_ps(acc[0].clipped, acc[1].clipped));
+  float peak(0.0f), sumI(0.0f), sumQ(0.0f), sumPower(0.0f), clipped(0.0f);
+  for (size_t k = 0; k < 8; k++)
+    {
+      peak = std::max(peak, lanes[0][k]);
+      if (complex and k % 2 == 1) sumQ += lanes[1][k];
+      else sumI += lanes[1][k];
+      sumPower += lanes[2][k];
+      clipped += lanes[3][k];
+    }
+  stats.peak = std::max<double>(stats.peak, peak);
+  stats.sumI += sumI;
+  stats.sumQ += sumQ;
+  stats.sumPower += sumPower;
+  stats.numClipped += size_t(clipped);
+  stats.numElems += i/depth;
+  genericAccumulate(values+i, numElems-i/depth, depth, scale, clipLevel, stats);
+}
+
+#endif //SOAPY_SDR_CONVERTERS_X86
+
+/*!
+ * Accumulate the statistics of a chunk of CF32 (depth 2) or F32 (depth 1) values.
+ * Called by ConverterPlan::execute() with the statistics argument.
+ */
+void accumulateConverterStats(const float *values, const size_t numElems, const size_t depth, const float scale, const float clipLevel, SoapySDR::ConverterStats &stats)
+{
+#ifdef SOAPY_SDR_CONVERTERS_X86
+  static const AccumulateFunction accumulate =
+    ((SoapySDR::ConverterRegistry::getCPUFeatures() & SoapySDR::ConverterRegistry::CPU_AVX) != 0)?
+    &avxAccumulate:&genericAccumulate;
+#else
+  static const AccumulateFunction accumulate = &genericAccumulate;
+#endif //SOAPY_SDR_CONVERTERS_X86
+  accumulate(values, numElems, depth, scale, clipLevel, stats);
+}
@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "ConverterThreadPool.hpp"
+#include <condition_variable>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <deque>
+#include <vector>
+
+/***********************************************************************
+ * A job lives on the stack of the thread that called converterParallelFor()
+ * and is referenced from the queue until every chunk has been claimed.
+ **********************************************************************/
+struct ConverterJob
+{
+  const std::function<void(const size_t)> *work;
+  size_t numChunks;
+  size_t maxHelpers;
+  std::atomic<size_t> nextChunk;
+  size_t numHelpers; //protected by the pool mutex
+  size_t activeHelpers; //protected by the pool mutex
+};
+
+static void runChunks(ConverterJob &job)
+{
+  while (true)
+    {
+      const size_t chunk = job.nextChunk.fetch_add(1);
+      if (chunk >= job.numChunks) break;
+      (*job.work)(chunk);
+    }
+}
+
+class ConverterThreadPool
+{
+public:
+  ConverterThreadPool(void):
+    _stopping(false)
+  {
+    return;
+  }
+
+  void run(ConverterJob &job)
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      //after shutdown() the caller converts every chunk itself
+      if (_stopping) job.maxHelpers = 0;
+
+      //grow the pool on demand, up to one worker per CPU besides the caller
+      while (_workers.size() < job.maxHelpers)
+        {
+          _workers.push_back(std::thread(&ConverterThreadPool::workerLoop, this));
+        }
+      _jobs.push_back(&job);
+    }
+    _jobCond.notify_all();
+
+    runChunks(job);
+
+    //wait for helpers to finish the chunks they claimed
+    std::unique_lock<std::mutex> lock(_mutex);
+    _jobs.erase(std::remove(_jobs.begin(), _jobs.end(), &job), _jobs.end());
+    _doneCond.wait(lock, [&job]{return job.activeHelpers == 0;});
+  }
+
+  /*!
+   * Stop the workers and wait for them to exit.
+   * A job in progress is finished by its calling thread.
+   */
+  void shutdown(void)
+  {
+    std::vector<std::thread> workers;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stopping = true;
+      workers.swap(_workers);
+    }
+    _jobCond.notify_all();
+    for (auto &worker : workers)
+      {
+#ifdef _WIN32
+        //joining under the DLL loader lock deadlocks, so the workers are only signalled to exit
+        worker.detach();
+#else
+        worker.join();
+#endif
+      }
+  }
+
+private:
+  void workerLoop(void)
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (not _stopping)
+      {
+        ConverterJob *job = nullptr;
+        for (auto *candidate : _jobs)
+          {
+            if (candidate->numHelpers >= candidate->maxHelpers) continue;
+            if (candidate->nextChunk.load() >= candidate->numChunks) continue;
+            job = candidate;
+            break;
+          }
+        if (job == nullptr)
+          {
+            _jobCond.wait(lock);
+            continue;
+          }
+
+        job->numHelpers++;
+        job->activeHelpers++;
+        lock.unlock();
+        runChunks(*job);
+        lock.lock();
+        if (--job->activeHelpers == 0) _doneCond.notify_all();
+      }
+  }
+
+  std::mutex _mutex;
+  std::condition_variable _jobCond;
+  std::condition_variable _doneCond;
+  std::deque<ConverterJob *> _jobs;
+  std::vector<std::thread> _workers;
+  bool _stopping;
+};
+
+//leaked so that conversions during static destruction still work, on the calling thread
+static ConverterThreadPool &getConverterThreadPool(void)
+{
+  static ConverterThreadPool *pool = new ConverterThreadPool();
+  return *pool;
+}
+
+/*!
+ * Stop the workers when the library is unloaded or the process exits,
+ * so that no worker is left running library code that is being unmapped.
+ */
+static struct ConverterThreadPoolShutdown
+{
+  ~ConverterThreadPoolShutdown(void)
+  {
+    getConverterThreadPool().shutdown();
+  }
+} converterThreadPoolShutdown;
+
+size_t converterMaxThreads(void)
+{
+  static const size_t numThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+  return numThreads;
+}
+
+void converterParallelFor(const size_t numChunks, const size_t numThreads, const std::function<void(const size_t)> &work)
+{
+  ConverterJob job;
+  job.work = &work;
+  job.numChunks = numChunks;
+  job.maxHelpers = std::min(std::min(numThreads, numChunks), converterMaxThreads());
+  job.maxHelpers = (job.maxHelpers == 0)?0:job.maxHelpers-1;
+  job.nextChunk = 0;
+  job.numHelpers = 0;
+  job.activeHelpers = 0;
+
+  if (job.maxHelpers == 0) return runChunks(job);
+  getConverterThreadPool().run(job);
+}
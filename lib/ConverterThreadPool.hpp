@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <functional>
+#include <cstddef>
+
+/***********************************************************************
+ * Shared worker pool for parallel conversions.
+ **********************************************************************/
+
+/*!
+ * Run a parallel for loop over the chunk indexes [0, numChunks).
+ * The calling thread processes chunks as well and returns once every chunk
+ * has completed. Chunks are handed out dynamically, so the work
+ * balances itself when some threads are delayed.
+ * The shared pool grows to the largest number of threads requested,
+ * with no more threads than converterMaxThreads() including the caller.
+ * \param numChunks the number of chunks to process
+ * \param numThreads the maximum number of threads, including the caller
+ * \param work the function to call with each chunk index
+ */
+void converterParallelFor(const size_t numChunks, const size_t numThreads, const std::function<void(const size_t)> &work);
+
+//! The default number of threads for parallel conversions: one per CPU
+size_t converterMaxThreads(void);
@@ -6,6 +6,8 @@
 
 #include <SoapySDR/Converters.h>
 #include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/ConverterPlan.hpp>
+#include <SoapySDR/ConverterMixer.hpp>
 
 #include <type_traits>
 
@@ -14,6 +16,15 @@ extern "C" {
 static_assert(int(SoapySDR::ConverterRegistry::GENERIC) == int(SOAPY_SDR_CONVERTER_GENERIC), "GENERIC");
 static_assert(int(SoapySDR::ConverterRegistry::VECTORIZED) == int(SOAPY_SDR_CONVERTER_VECTORIZED), "VECTORIZED");
 static_assert(int(SoapySDR::ConverterRegistry::CUSTOM) == int(SOAPY_SDR_CONVERTER_CUSTOM), "CUSTOM");
+static_assert(int(SoapySDR::ConverterRegistry::CPU_SSE2) == int(SOAPY_SDR_CPU_SSE2), "CPU_SSE2");
+static_assert(int(SoapySDR::ConverterRegistry::CPU_SSSE3) == int(SOAPY_SDR_CPU_SSSE3), "CPU_SSSE3");
+static_assert(int(SoapySDR::ConverterRegistry::CPU_SSE41) == int(SOAPY_SDR_CPU_SSE41), "CPU_SSE41");
+static_assert(int(SoapySDR::ConverterRegistry::CPU_AVX) == int(SOAPY_SDR_CPU_AVX), "CPU_AVX");
+static_assert(int(SoapySDR::ConverterRegistry::CPU_AVX2) == int(SOAPY_SDR_CPU_AVX2), "CPU_AVX2");
+static_assert(int(SoapySDR::ConverterRegistry::CPU_FMA) == int(SOAPY_SDR_CPU_FMA), "CPU_FMA");
+static_assert(int(SoapySDR::ConverterRegistry::CPU_F16C) == int(SOAPY_SDR_CPU_F16C), "CPU_F16C");
+static_assert(int(SoapySDR::ConverterRegistry::CPU_AVX512F) == int(SOAPY_SDR_CPU_AVX512F), "CPU_AVX512F");
+static_assert(int(SoapySDR::ConverterRegistry::CPU_AVX512BW) == int(SOAPY_SDR_CPU_AVX512BW), "CPU_AVX512BW");
 static_assert(std::is_same<SoapySDR::ConverterRegistry::ConverterFunction, SoapySDRConverterFunction>::value, "ConverterFunction");
 
 char **SoapySDRConverter_listTargetFormats(const char *sourceFormat, size_t *length)
@@ -69,6 +80,20 @@ SoapySDRConverterFunction SoapySDRConverter_getFunctionWithPriority(const char *
     __SOAPY_SDR_C_CATCH_RET(nullptr);
 }
 
+bool SoapySDRConverter_supportsInPlace(const char *sourceFormat, const char *targetFormat)
+{
+    __SOAPY_SDR_C_TRY
+    return SoapySDR::ConverterRegistry::supportsInPlace(sourceFormat, targetFormat);
+    __SOAPY_SDR_C_CATCH_RET(false);
+}
+
+SoapySDRConverterFunction SoapySDRConverter_getSaturatingFunction(const char *sourceFormat, const char *targetFormat)
+{
+    __SOAPY_SDR_C_TRY
+    return static_cast<SoapySDRConverterFunction>(SoapySDR::ConverterRegistry::getSaturatingFunction(sourceFormat, targetFormat));
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
 char **SoapySDRConverter_listAvailableSourceFormats(size_t *length)
 {
     *length = 0;
@@ -78,4 +103,146 @@ char **SoapySDRConverter_listAvailableSourceFormats(size_t *length)
     __SOAPY_SDR_C_CATCH_RET(nullptr);
 }
 
+int SoapySDRConverter_getCPUFeatures(void)
+{
+    return SoapySDR::ConverterRegistry::getCPUFeatures();
+}
+
+SoapySDRConverterPlan *SoapySDRConverterPlan_make(const char *sourceFormat, const char *targetFormat, const double scaler)
+{
+    __SOAPY_SDR_C_TRY
+    return (SoapySDRConverterPlan *)new SoapySDR::ConverterPlan(sourceFormat, targetFormat, scaler);
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+SoapySDRConverterPlan *SoapySDRConverterPlan_makeWithPriority(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionPriority priority, const double scaler)
+{
+    __SOAPY_SDR_C_TRY
+    return (SoapySDRConverterPlan *)new SoapySDR::ConverterPlan(sourceFormat, targetFormat, static_cast<SoapySDR::ConverterRegistry::FunctionPriority>(priority), scaler);
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+int SoapySDRConverterPlan_unmake(SoapySDRConverterPlan *plan)
+{
+    __SOAPY_SDR_C_TRY
+    delete (SoapySDR::ConverterPlan *)plan;
+    __SOAPY_SDR_C_CATCH
+}
+
+void SoapySDRConverterPlan_execute(const SoapySDRConverterPlan *plan, const void *srcBuff, void *dstBuff, const size_t numElems)
+{
+    ((const SoapySDR::ConverterPlan *)plan)->execute(srcBuff, dstBuff, numElems);
+}
+
+int SoapySDRConverterPlan_executeParallel(const SoapySDRConverterPlan *plan, const void *srcBuff, void *dstBuff, const size_t numElems, const size_t numThreads)
+{
+    __SOAPY_SDR_C_TRY
+    ((const SoapySDR::ConverterPlan *)plan)->executeParallel(srcBuff, dstBuff, numElems, numThreads);
+    __SOAPY_SDR_C_CATCH
+}
+
+SoapySDRConverterFunctionPriority SoapySDRConverterPlan_getPriority(const SoapySDRConverterPlan *plan)
+{
+    return static_cast<SoapySDRConverterFunctionPriority>(((const SoapySDR::ConverterPlan *)plan)->getPriority());
+}
+
+SoapySDRConverterFunction SoapySDRConverterPlan_getFunction(const SoapySDRConverterPlan *plan)
+{
+    return ((const SoapySDR::ConverterPlan *)plan)->getFunction();
+}
+
+size_t SoapySDRConverterPlan_getSourceSize(const SoapySDRConverterPlan *plan)
+{
+    return ((const SoapySDR::ConverterPlan *)plan)->getSourceSize();
+}
+
+size_t SoapySDRConverterPlan_getTargetSize(const SoapySDRConverterPlan *plan)
+{
+    return ((const SoapySDR::ConverterPlan *)plan)->getTargetSize();
+}
+
+bool SoapySDRConverterPlan_supportsInPlace(const SoapySDRConverterPlan *plan)
+{
+    return ((const SoapySDR::ConverterPlan *)plan)->supportsInPlace();
+}
+
+void SoapySDRConverterPlan_executeBatch(const SoapySDRConverterPlan *plan, const void * const *srcBuffs, void * const *dstBuffs, const size_t numBuffs, const size_t numElems)
+{
+    ((const SoapySDR::ConverterPlan *)plan)->executeBatch(srcBuffs, dstBuffs, numBuffs, numElems);
+}
+
+int SoapySDRConverterPlan_executeWithStats(const SoapySDRConverterPlan *plan, const void *srcBuff, void *dstBuff, const size_t numElems, SoapySDRConverterStats *stats)
+{
+    __SOAPY_SDR_C_TRY
+    SoapySDR::ConverterStats statsCpp;
+    statsCpp.numElems = stats->numElems;
+    statsCpp.numClipped = stats->numClipped;
+    statsCpp.peak = stats->peak;
+    statsCpp.sumI = stats->sumI;
+    statsCpp.sumQ = stats->sumQ;
+    statsCpp.sumPower = stats->sumPower;
+    ((const SoapySDR::ConverterPlan *)plan)->execute(srcBuff, dstBuff, numElems, statsCpp);
+    stats->numElems = statsCpp.numElems;
+    stats->numClipped = statsCpp.numClipped;
+    stats->peak = statsCpp.peak;
+    stats->sumI = statsCpp.sumI;
+    stats->sumQ = statsCpp.sumQ;
+    stats->sumPower = statsCpp.sumPower;
+    __SOAPY_SDR_C_CATCH
+}
+
+const char *SoapySDRConverterPlan_getSourceFormat(const SoapySDRConverterPlan *plan)
+{
+    return ((const SoapySDR::ConverterPlan *)plan)->getSourceFormat().c_str();
+}
+
+const char *SoapySDRConverterPlan_getTargetFormat(const SoapySDRConverterPlan *plan)
+{
+    return ((const SoapySDR::ConverterPlan *)plan)->getTargetFormat().c_str();
+}
+
+double SoapySDRConverterPlan_getScaler(const SoapySDRConverterPlan *plan)
+{
+    return ((const SoapySDR::ConverterPlan *)plan)->getScaler();
+}
+
+SoapySDRConverterMixer *SoapySDRConverterMixer_make(const char *sourceFormat, const char *targetFormat, const double frequency, const double scaler)
+{
+    __SOAPY_SDR_C_TRY
+    return (SoapySDRConverterMixer *)new SoapySDR::ConverterMixer(sourceFormat, targetFormat, frequency, scaler);
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+int SoapySDRConverterMixer_unmake(SoapySDRConverterMixer *mixer)
+{
+    __SOAPY_SDR_C_TRY
+    delete (SoapySDR::ConverterMixer *)mixer;
+    __SOAPY_SDR_C_CATCH
+}
+
+void SoapySDRConverterMixer_execute(SoapySDRConverterMixer *mixer, const void *srcBuff, void *dstBuff, const size_t numElems)
+{
+    ((SoapySDR::ConverterMixer *)mixer)->execute(srcBuff, dstBuff, numElems);
+}
+
+void SoapySDRConverterMixer_setFrequency(SoapySDRConverterMixer *mixer, const double frequency)
+{
+    ((SoapySDR::ConverterMixer *)mixer)->setFrequency(frequency);
+}
+
+double SoapySDRConverterMixer_getFrequency(const SoapySDRConverterMixer *mixer)
+{
+    return ((const SoapySDR::ConverterMixer *)mixer)->getFrequency();
+}
+
+void SoapySDRConverterMixer_setPhase(SoapySDRConverterMixer *mixer, const double phase)
+{
+    ((SoapySDR::ConverterMixer *)mixer)->setPhase(phase);
+}
+
+double SoapySDRConverterMixer_getPhase(const SoapySDRConverterMixer *mixer)
+{
+    return ((const SoapySDR::ConverterMixer *)mixer)->getPhase();
+}
+
 }
@@ -5,12 +5,23 @@
 
 #include <SoapySDR/Device.hpp>
 #include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Errors.hpp>
+#include <SoapySDR/Logger.hpp>
+#include <SoapySDR/Buffer.hpp>
+#include <condition_variable>
+#include <stdexcept>
+#include <memory>
+#include <mutex>
+#include <chrono>
 #include <cstdlib>
+#include <map>
 #include <algorithm> //min/max/find
 
+static void eraseEmulatedStreams(const SoapySDR::Device *device);
+
 SoapySDR::Device::~Device(void)
 {
-    return;
+    eraseEmulatedStreams(this);
 }
 
 /*******************************************************************
@@ -123,37 +134,219 @@ int SoapySDR::Device::readStreamStatus(Stream *, size_t &, int &, long long &, c
     return SOAPY_SDR_NOT_SUPPORTED;
 }
 
+/*******************************************************************
+ * Direct buffer access emulation
+ ******************************************************************/
+
+/*!
+ * A pool of buffers that stands in for the driver's DMA buffers.
+ * The acquire and release calls may come from different threads,
+ * so the pool tracks which buffers are held under its own mutex.
+ * The pool is owned by the handle from enableDirectAccessEmulation(),
+ * and the registry below only refers to it while that handle lives.
+ */
+class SoapySDR::DirectAccessEmulation
+{
+public:
+    ~DirectAccessEmulation(void);
+
+    const SoapySDR::Device *device;
+    SoapySDR::Stream *stream;
+    int direction;
+    size_t numChans;
+    size_t elemSize;
+    size_t mtu;
+    SoapySDR::Buffer memory;
+    std::vector<std::vector<void *>> buffs;
+    std::vector<std::vector<const void *>> cursors; //per buffer write positions
+    std::vector<bool> held;
+    std::mutex mutex;
+    std::condition_variable cond;
+
+    //wait for a free buffer like a driver waits for DMA
+    bool acquire(size_t &handle, const long timeoutUs)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        const auto isFree = [this, &handle]
+        {
+            const auto it = std::find(held.begin(), held.end(), false);
+            handle = size_t(it - held.begin());
+            return it != held.end();
+        };
+        if (not cond.wait_for(lock, std::chrono::microseconds(timeoutUs), isFree)) return false;
+        held[handle] = true;
+        return true;
+    }
+
+    void release(const size_t handle)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (handle < held.size()) held[handle] = false;
+        }
+        cond.notify_one();
+    }
+};
+
+typedef std::map<std::pair<const SoapySDR::Device *, SoapySDR::Stream *>, std::weak_ptr<SoapySDR::DirectAccessEmulation>> EmulatedStreams;
+
+//leaked, since devices may be destroyed during static destruction
+static std::mutex &getEmulatedStreamsMutex(void)
+{
+    static std::mutex *mutex = new std::mutex();
+    return *mutex;
+}
+
+static EmulatedStreams &getEmulatedStreams(void)
+{
+    static EmulatedStreams *streams = new EmulatedStreams();
+    return *streams;
+}
+
+//the returned reference keeps the pool alive while a call uses it
+static std::shared_ptr<SoapySDR::DirectAccessEmulation> getEmulatedStream(const SoapySDR::Device *device, SoapySDR::Stream *stream)
+{
+    std::lock_guard<std::mutex> lock(getEmulatedStreamsMutex());
+    const auto it = getEmulatedStreams().find(std::make_pair(device, stream));
+    if (it == getEmulatedStreams().end()) return nullptr;
+    return it->second.lock();
+}
+
+SoapySDR::DirectAccessEmulation::~DirectAccessEmulation(void)
+{
+    //a newer pool may have been enabled for the same stream address
+    std::lock_guard<std::mutex> lock(getEmulatedStreamsMutex());
+    auto &streams = getEmulatedStreams();
+    const auto it = streams.find(std::make_pair(device, stream));
+    if (it != streams.end() and it->second.expired()) streams.erase(it);
+}
+
+static void eraseEmulatedStreams(const SoapySDR::Device *device)
+{
+    std::lock_guard<std::mutex> lock(getEmulatedStreamsMutex());
+    auto &streams = getEmulatedStreams();
+    auto it = streams.lower_bound(std::make_pair(device, (SoapySDR::Stream *)nullptr));
+    while (it != streams.end() and it->first.first == device) it = streams.erase(it);
+}
+
+std::shared_ptr<SoapySDR::DirectAccessEmulation> SoapySDR::Device::enableDirectAccessEmulation(Stream *stream, const int direction, const std::string &format, const size_t numChans, const size_t numBuffs)
+{
+    const size_t elemSize = SoapySDR::formatToSize(format);
+    if (stream == nullptr or elemSize == 0 or numChans == 0 or numBuffs == 0)
+    {
+        throw std::invalid_argument("Device::enableDirectAccessEmulation() invalid stream layout, format="+format);
+    }
+
+    std::shared_ptr<DirectAccessEmulation> emulated(new DirectAccessEmulation());
+    emulated->device = this;
+    emulated->stream = stream;
+    emulated->direction = direction;
+    emulated->numChans = numChans;
+    emulated->elemSize = elemSize;
+    emulated->mtu = this->getStreamMTU(stream);
+
+    //the stream channels are unknown here, so place the pool near channel 0
+    SoapySDR::BufferArgs args;
+    args.numaNode = SoapySDR::getNumaNode(this, direction, 0);
+    const size_t stride = (emulated->mtu*elemSize + args.alignment - 1) & ~(args.alignment - 1);
+    emulated->memory = SoapySDR::Buffer(numBuffs*numChans*stride, args);
+    char *p = (char *)emulated->memory.data();
+    for (size_t i = 0; i < numBuffs; i++)
+    {
+        emulated->buffs.emplace_back();
+        for (size_t ch = 0; ch < numChans; ch++, p += stride) emulated->buffs.back().push_back(p);
+    }
+    emulated->cursors.resize(numBuffs, std::vector<const void *>(numChans));
+    emulated->held.resize(numBuffs, false);
+
+    std::lock_guard<std::mutex> lock(getEmulatedStreamsMutex());
+    getEmulatedStreams()[std::make_pair(this, stream)] = emulated;
+    return emulated;
+}
+
 /*******************************************************************
  * Direct buffer access API
  ******************************************************************/
-size_t SoapySDR::Device::getNumDirectAccessBuffers(Stream *)
+size_t SoapySDR::Device::getNumDirectAccessBuffers(Stream *stream)
 {
-    return 0;
+    const auto emulated = getEmulatedStream(this, stream);
+    return emulated? emulated->buffs.size() : 0;
 }
 
-int SoapySDR::Device::getDirectAccessBufferAddrs(Stream *, const size_t, void **)
+int SoapySDR::Device::getDirectAccessBufferAddrs(Stream *stream, const size_t handle, void **buffs)
 {
-    return SOAPY_SDR_NOT_SUPPORTED;
+    const auto emulated = getEmulatedStream(this, stream);
+    if (not emulated) return SOAPY_SDR_NOT_SUPPORTED;
+    if (handle >= emulated->buffs.size()) return SOAPY_SDR_STREAM_ERROR;
+    std::copy(emulated->buffs[handle].begin(), emulated->buffs[handle].end(), buffs);
+    return 0;
 }
 
-int SoapySDR::Device::acquireReadBuffer(Stream *, size_t &, const void **, int &, long long &, const long)
+int SoapySDR::Device::acquireReadBuffer(Stream *stream, size_t &handle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs)
 {
-    return SOAPY_SDR_NOT_SUPPORTED;
+    const auto emulated = getEmulatedStream(this, stream);
+    if (not emulated or emulated->direction != SOAPY_SDR_RX) return SOAPY_SDR_NOT_SUPPORTED;
+    const auto start = std::chrono::steady_clock::now();
+    if (not emulated->acquire(handle, timeoutUs)) return SOAPY_SDR_TIMEOUT;
+
+    //the driver reads straight into the buffer handed to the caller,
+    //within what is left of the timeout after waiting for the buffer
+    const long waitedUs = long(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    const auto &addrs = emulated->buffs[handle];
+    const int ret = this->readStream(stream, addrs.data(), emulated->mtu, flags, timeNs, std::max(0L, timeoutUs - waitedUs));
+    if (ret < 0)
+    {
+        emulated->release(handle);
+        return ret;
+    }
+    std::copy(addrs.begin(), addrs.end(), buffs);
+    return ret;
 }
 
-void SoapySDR::Device::releaseReadBuffer(Stream *, const size_t)
+void SoapySDR::Device::releaseReadBuffer(Stream *stream, const size_t handle)
 {
-    return;
+    const auto emulated = getEmulatedStream(this, stream);
+    if (emulated and emulated->direction == SOAPY_SDR_RX) emulated->release(handle);
 }
 
-int SoapySDR::Device::acquireWriteBuffer(Stream *, size_t &, void **, const long)
+int SoapySDR::Device::acquireWriteBuffer(Stream *stream, size_t &handle, void **buffs, const long timeoutUs)
 {
-    return SOAPY_SDR_NOT_SUPPORTED;
+    const auto emulated = getEmulatedStream(this, stream);
+    if (not emulated or emulated->direction != SOAPY_SDR_TX) return SOAPY_SDR_NOT_SUPPORTED;
+    if (not emulated->acquire(handle, timeoutUs)) return SOAPY_SDR_TIMEOUT;
+    std::copy(emulated->buffs[handle].begin(), emulated->buffs[handle].end(), buffs);
+    return int(emulated->mtu);
 }
 
-void SoapySDR::Device::releaseWriteBuffer(Stream *, const size_t, const size_t, int &, const long long)
+void SoapySDR::Device::releaseWriteBuffer(Stream *stream, const size_t handle, const size_t numElems, int &flags, const long long timeNs)
 {
-    return;
+    const auto emulated = getEmulatedStream(this, stream);
+    if (not emulated or emulated->direction != SOAPY_SDR_TX or handle >= emulated->buffs.size()) return;
+
+    //the driver may take the buffer in several calls,
+    //the timestamp only applies to the first element
+    const auto &addrs = emulated->buffs[handle];
+    auto &cursor = emulated->cursors[handle];
+    const int inFlags = flags;
+    size_t offset(0);
+    do
+    {
+        for (size_t i = 0; i < emulated->numChans; i++)
+        {
+            cursor[i] = (const char *)addrs[i] + offset*emulated->elemSize;
+        }
+        flags = (offset == 0)? inFlags : (inFlags & ~SOAPY_SDR_HAS_TIME);
+        const int ret = this->writeStream(stream, cursor.data(), numElems-offset, flags, timeNs);
+        if (ret < 0 or (ret == 0 and offset < numElems))
+        {
+            SoapySDR::logf(SOAPY_SDR_WARNING, "releaseWriteBuffer() emulation dropped %d elements: %s",
+                int(numElems-offset), SoapySDR::errToStr(ret));
+            break;
+        }
+        offset += size_t(ret);
+    } while (offset < numElems);
+
+    emulated->release(handle);
 }
 
 /*******************************************************************
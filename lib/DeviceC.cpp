@@ -6,7 +6,11 @@
 #include "TypeHelpers.hpp"
 #include <SoapySDR/Device.h>
 #include <SoapySDR/Device.hpp>
+#include <SoapySDR/Formats.hpp>
 #include <algorithm>
+#include <memory>
+#include <mutex>
+#include <map>
 #include <cstdlib>
 #include <cstring>
 #include <cmath> //NAN
@@ -65,6 +69,89 @@ static SoapySDRArgInfo SoapySDRArgInfoNull(void)
  ******************************************************************/
 struct SoapySDRDevice : SoapySDR::Device {};
 
+/*******************************************************************
+ * Direct access emulation of C API streams
+ *
+ * setupStream() records the stream layout, and the first direct
+ * access call creates the pool when the driver has no direct access,
+ * so streams that only use read/writeStream() allocate nothing.
+ ******************************************************************/
+struct EmulationEntry
+{
+    int direction;
+    std::string format;
+    size_t numChans;
+    bool resolved;
+    std::shared_ptr<SoapySDR::DirectAccessEmulation> handle;
+};
+
+typedef std::map<std::pair<const SoapySDRDevice *, SoapySDR::Stream *>, EmulationEntry> EmulationHandles;
+
+//leaked, since devices may be destroyed during static destruction
+static std::mutex &getEmulationHandlesMutex(void)
+{
+    static std::mutex *mutex = new std::mutex();
+    return *mutex;
+}
+
+static EmulationHandles &getEmulationHandles(void)
+{
+    static EmulationHandles *handles = new EmulationHandles();
+    return *handles;
+}
+
+//record the layout of a new stream, or forget a closed one with a null format;
+//the handle of a previous stream at the same address is released either way
+static void setEmulationLayout(const SoapySDRDevice *device, SoapySDR::Stream *stream, const int direction, const char *format, const size_t numChans)
+{
+    std::shared_ptr<SoapySDR::DirectAccessEmulation> previous;
+    std::lock_guard<std::mutex> lock(getEmulationHandlesMutex());
+    auto &handles = getEmulationHandles();
+    const auto key = std::make_pair(device, stream);
+    const auto it = handles.find(key);
+    if (it != handles.end()) previous.swap(it->second.handle);
+    if (format != nullptr and SoapySDR::formatToSize(format) != 0)
+    {
+        EmulationEntry &entry = handles[key];
+        entry.direction = direction;
+        entry.format = format;
+        entry.numChans = std::max<size_t>(1, numChans);
+        entry.resolved = false;
+    }
+    else if (it != handles.end()) handles.erase(it);
+}
+
+//enable the emulation on the first direct access call, unless the driver has direct access
+static void resolveEmulation(SoapySDRDevice *device, SoapySDRStream *stream)
+{
+    auto rawStream = reinterpret_cast<SoapySDR::Stream *>(stream);
+    std::lock_guard<std::mutex> lock(getEmulationHandlesMutex());
+    auto &handles = getEmulationHandles();
+    const auto it = handles.find(std::make_pair((const SoapySDRDevice *)device, rawStream));
+    if (it == handles.end() or it->second.resolved) return;
+
+    EmulationEntry &entry = it->second;
+    if (device->getNumDirectAccessBuffers(rawStream) == 0)
+    {
+        entry.handle = device->enableDirectAccessEmulation(rawStream, entry.direction, entry.format, entry.numChans);
+    }
+    entry.resolved = true;
+}
+
+//release the handles of streams left open when the device is unmade
+void releaseEmulationHandles(const SoapySDRDevice *device)
+{
+    std::vector<std::shared_ptr<SoapySDR::DirectAccessEmulation>> released;
+    std::lock_guard<std::mutex> lock(getEmulationHandlesMutex());
+    auto &handles = getEmulationHandles();
+    auto it = handles.lower_bound(std::make_pair(device, (SoapySDR::Stream *)nullptr));
+    while (it != handles.end() and it->first.first == device)
+    {
+        released.push_back(it->second.handle);
+        it = handles.erase(it);
+    }
+}
+
 extern "C" {
 
 /*******************************************************************
@@ -160,13 +247,27 @@ SoapySDRArgInfo *SoapySDRDevice_getStreamArgsInfo(const SoapySDRDevice *device,
 SoapySDRStream *SoapySDRDevice_setupStream(SoapySDRDevice *device, const int direction, const char *format, const size_t *channels, const size_t numChans, const SoapySDRKwargs *args)
 {
     __SOAPY_SDR_C_TRY
-    return reinterpret_cast<SoapySDRStream *>(device->setupStream(direction, format, std::vector<size_t>(channels, channels+numChans), toKwargs(args)));
+    auto stream = device->setupStream(direction, format, std::vector<size_t>(channels, channels+numChans), toKwargs(args));
+    if (stream == nullptr) return nullptr;
+
+    //every stream supports direct buffer access, emulated when the driver has none
+    try
+    {
+        setEmulationLayout(device, stream, direction, format, numChans);
+    }
+    catch (...)
+    {
+        device->closeStream(stream);
+        throw;
+    }
+    return reinterpret_cast<SoapySDRStream *>(stream);
     __SOAPY_SDR_C_CATCH_RET(nullptr);
 }
 
 int SoapySDRDevice_closeStream(SoapySDRDevice *device, SoapySDRStream *stream)
 {
     __SOAPY_SDR_C_TRY
+    setEmulationLayout(device, reinterpret_cast<SoapySDR::Stream *>(stream), 0, nullptr, 0);
     device->closeStream(reinterpret_cast<SoapySDR::Stream *>(stream));
     __SOAPY_SDR_C_CATCH
 }
@@ -226,6 +327,7 @@ int SoapySDRDevice_readStreamStatus(SoapySDRDevice *device, SoapySDRStream *stre
 size_t SoapySDRDevice_getNumDirectAccessBuffers(SoapySDRDevice *device, SoapySDRStream *stream)
 {
     __SOAPY_SDR_C_TRY
+    resolveEmulation(device, stream);
     return device->getNumDirectAccessBuffers(reinterpret_cast<SoapySDR::Stream *>(stream));
     __SOAPY_SDR_C_CATCH_RET(std::string::npos);
 }
@@ -233,6 +335,7 @@ size_t SoapySDRDevice_getNumDirectAccessBuffers(SoapySDRDevice *device, SoapySDR
 int SoapySDRDevice_getDirectAccessBufferAddrs(SoapySDRDevice *device, SoapySDRStream *stream, const size_t handle, void **buffs)
 {
     __SOAPY_SDR_C_TRY
+    resolveEmulation(device, stream);
     return device->getDirectAccessBufferAddrs(reinterpret_cast<SoapySDR::Stream *>(stream), handle, buffs);
     __SOAPY_SDR_C_CATCH
 }
@@ -246,6 +349,7 @@ int SoapySDRDevice_acquireReadBuffer(SoapySDRDevice *device,
     const long timeoutUs)
 {
     __SOAPY_SDR_C_TRY
+    resolveEmulation(device, stream);
     return device->acquireReadBuffer(reinterpret_cast<SoapySDR::Stream *>(stream), *handle, buffs, *flags, *timeNs, timeoutUs);
     __SOAPY_SDR_C_CATCH_RET(SOAPY_SDR_STREAM_ERROR);
 }
@@ -266,6 +370,7 @@ int SoapySDRDevice_acquireWriteBuffer(SoapySDRDevice *device,
     const long timeoutUs)
 {
     __SOAPY_SDR_C_TRY
+    resolveEmulation(device, stream);
     return device->acquireWriteBuffer(reinterpret_cast<SoapySDR::Stream *>(stream), *handle, buffs, timeoutUs);
     __SOAPY_SDR_C_CATCH_RET(SOAPY_SDR_STREAM_ERROR);
 }
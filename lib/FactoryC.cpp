@@ -8,6 +8,9 @@
 #include <cstdlib>
 #include <cstring>
 
+//release the direct access emulation of streams left open, see DeviceC.cpp
+void releaseEmulationHandles(const SoapySDRDevice *device);
+
 extern "C" {
 
 SoapySDRKwargs *SoapySDRDevice_enumerate(const SoapySDRKwargs *args, size_t *length)
@@ -43,6 +46,7 @@ SoapySDRDevice *SoapySDRDevice_makeStrArgs(const char *args)
 int SoapySDRDevice_unmake(SoapySDRDevice *device)
 {
     __SOAPY_SDR_C_TRY
+    releaseEmulationHandles(device);
     SoapySDR::Device::unmake((SoapySDR::Device *)device);
     __SOAPY_SDR_C_CATCH
 }
@@ -74,7 +78,11 @@ int SoapySDRDevice_unmake_list(SoapySDRDevice **devices, const size_t length)
 {
     __SOAPY_SDR_C_TRY
     std::vector<SoapySDR::Device *> devicesVector(length);
-    for (size_t i = 0; i < length; i++) devicesVector[i] = (SoapySDR::Device *)devices[i];
+    for (size_t i = 0; i < length; i++)
+    {
+        releaseEmulationHandles(devices[i]);
+        devicesVector[i] = (SoapySDR::Device *)devices[i];
+    }
     SoapySDR_free(devices);
     SoapySDR::Device::unmake(devicesVector);
     __SOAPY_SDR_C_CATCH
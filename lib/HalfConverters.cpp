@@ -0,0 +1,264 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// Converters for the IEEE 754 half precision formats F16 and CF16.
+// The generic converters use the F16toF32() and F32toF16() primitives,
+// which round to nearest even exactly like the F16C instructions,
+// so the F16C and AVX-512 kernels are bit-exact with them.
+// Other formats reach F16/CF16 through a chain of converters (see ConverterPlan).
+
+#include <SoapySDR/ConverterPrimitives.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include "VectorizedHelpers.hpp"
+
+typedef SoapySDR::ConverterRegistry CR;
+
+// ********************************
+// Generic converters
+
+template <size_t elemDepth>
+static void genericF32toF16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  if (scaler == 1.0) for (size_t i = 0; i < n; i++) dst[i] = SoapySDR::F32toF16(src[i]);
+  else for (size_t i = 0; i < n; i++) dst[i] = SoapySDR::F32toF16(src[i] * scaler);
+}
+
+template <size_t elemDepth>
+static void genericF16toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const uint16_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  if (scaler == 1.0) for (size_t i = 0; i < n; i++) dst[i] = SoapySDR::F16toF32(src[i]);
+  else for (size_t i = 0; i < n; i++) dst[i] = SoapySDR::F16toF32(src[i]) * scaler;
+}
+
+template <size_t elemDepth>
+static void genericS16toF16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  if (scaler == 1.0) for (size_t i = 0; i < n; i++) dst[i] = SoapySDR::F32toF16(SoapySDR::S16toF32(src[i]));
+  else for (size_t i = 0; i < n; i++) dst[i] = SoapySDR::F32toF16(SoapySDR::S16toF32(src[i]) * scaler);
+}
+
+template <size_t elemDepth>
+static void genericF16toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const uint16_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  if (scaler == 1.0) for (size_t i = 0; i < n; i++) dst[i] = SoapySDR::F32toS16(SoapySDR::F16toF32(src[i]));
+  else for (size_t i = 0; i < n; i++) dst[i] = SoapySDR::F32toS16(SoapySDR::F16toF32(src[i]) * scaler);
+}
+
+#ifdef SOAPY_SDR_CONVERTERS_X86
+
+// ********************************
+// F16C kernels
+
+template <size_t elemDepth>
+SOAPY_SDR_TARGET("avx,f16c")
+static void f16cF32toF16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, 1.0, f))
+    {
+      const __m256 factor = _mm256_set1_ps(f);
+      for (; i+8 <= n; i += 8)
+        {
+          const __m256 in = _mm256_mul_ps(_mm256_loadu_ps(src+i), factor);
+          _mm_storeu_si128((__m128i*)(dst+i), _mm256_cvtps_ph(in, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        }
+    }
+  genericF32toF16<1>(src+i, dst+i, n-i, scaler);
+}
+
+template <size_t elemDepth>
+SOAPY_SDR_TARGET("avx,f16c")
+static void f16cF16toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const uint16_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, 1.0, f))
+    {
+      const __m256 factor = _mm256_set1_ps(f);
+      for (; i+8 <= n; i += 8)
+        {
+          const __m256 out = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(src+i)));
+          _mm256_storeu_ps(dst+i, _mm256_mul_ps(out, factor));
+        }
+    }
+  genericF16toF32<1>(src+i, dst+i, n-i, scaler);
+}
+
+template <size_t elemDepth>
+SOAPY_SDR_TARGET("avx2,f16c")
+static void f16cS16toF16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, 1.0/SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m256 factor = _mm256_set1_ps(f);
+      for (; i+8 <= n; i += 8)
+        {
+          const __m256i in = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(src+i)));
+          const __m256 value = _mm256_mul_ps(_mm256_cvtepi32_ps(in), factor);
+          _mm_storeu_si128((__m128i*)(dst+i), _mm256_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        }
+    }
+  genericS16toF16<1>(src+i, dst+i, n-i, scaler);
+}
+
+template <size_t elemDepth>
+SOAPY_SDR_TARGET("avx2,f16c")
+static void f16cF16toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const uint16_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m256 factor = _mm256_set1_ps(f);
+      for (; i+16 <= n; i += 16)
+        {
+          //truncate and wrap like the scalar cast, as in avx2F32toS16x16()
+          const __m256i lo = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(src+i+0))), factor));
+          const __m256i hi = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(src+i+8))), factor));
+          const __m256i packed = _mm256_packs_epi32(
+            _mm256_srai_epi32(_mm256_slli_epi32(lo, 16), 16),
+            _mm256_srai_epi32(_mm256_slli_epi32(hi, 16), 16));
+          _mm256_storeu_si256((__m256i*)(dst+i), _mm256_permute4x64_epi64(packed, 0xD8));
+        }
+    }
+  genericF16toS16<1>(src+i, dst+i, n-i, scaler);
+}
+
+// ********************************
+// AVX-512 kernels
+// The all-ones zero-masked forms avoid the undefined pass-through
+// operand of the unmasked intrinsics, which gcc warns about.
+
+template <size_t elemDepth>
+SOAPY_SDR_TARGET("avx512f")
+static void avx512F32toF16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, 1.0, f))
+    {
+      const __m512 factor = _mm512_set1_ps(f);
+      for (; i+16 <= n; i += 16)
+        {
+          const __m512 in = _mm512_mul_ps(_mm512_loadu_ps(src+i), factor);
+          _mm256_storeu_si256((__m256i*)(dst+i), _mm512_maskz_cvtps_ph(0xffff, in, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        }
+    }
+  genericF32toF16<1>(src+i, dst+i, n-i, scaler);
+}
+
+template <size_t elemDepth>
+SOAPY_SDR_TARGET("avx512f")
+static void avx512F16toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const uint16_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, 1.0, f))
+    {
+      const __m512 factor = _mm512_set1_ps(f);
+      for (; i+16 <= n; i += 16)
+        {
+          const __m512 out = _mm512_maskz_cvtph_ps(0xffff, _mm256_loadu_si256((const __m256i*)(src+i)));
+          _mm512_storeu_ps(dst+i, _mm512_mul_ps(out, factor));
+        }
+    }
+  genericF16toF32<1>(src+i, dst+i, n-i, scaler);
+}
+
+template <size_t elemDepth>
+SOAPY_SDR_TARGET("avx512f")
+static void avx512S16toF16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, 1.0/SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m512 factor = _mm512_set1_ps(f);
+      for (; i+16 <= n; i += 16)
+        {
+          const __m512i in = _mm512_maskz_cvtepi16_epi32(0xffff, _mm256_loadu_si256((const __m256i*)(src+i)));
+          const __m512 value = _mm512_mul_ps(_mm512_maskz_cvtepi32_ps(0xffff, in), factor);
+          _mm256_storeu_si256((__m256i*)(dst+i), _mm512_maskz_cvtps_ph(0xffff, value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        }
+    }
+  genericS16toF16<1>(src+i, dst+i, n-i, scaler);
+}
+
+template <size_t elemDepth>
+SOAPY_SDR_TARGET("avx512f")
+static void avx512F16toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const uint16_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m512 factor = _mm512_set1_ps(f);
+      for (; i+16 <= n; i += 16)
+        {
+          //the truncating narrow keeps the low 16 bits, which wraps like the scalar cast
+          const __m512 value = _mm512_mul_ps(_mm512_maskz_cvtph_ps(0xffff, _mm256_loadu_si256((const __m256i*)(src+i))), factor);
+          _mm256_storeu_si256((__m256i*)(dst+i), _mm512_maskz_cvtepi32_epi16(0xffff, _mm512_maskz_cvttps_epi32(0xffff, value)));
+        }
+    }
+  genericF16toS16<1>(src+i, dst+i, n-i, scaler);
+}
+
+#endif //SOAPY_SDR_CONVERTERS_X86
+
+// ********************************
+// Registration
+
+//the integer kernels may need more features than the float kernels, see f16cS16toF16()
+#define SOAPY_SDR_REGISTER_HALF(prefix, priority, features, intFeatures) \
+  CR(SOAPY_SDR_F32, SOAPY_SDR_F16, priority, &prefix ## F32toF16<1>, features); \
+  CR(SOAPY_SDR_CF32, SOAPY_SDR_CF16, priority, &prefix ## F32toF16<2>, features); \
+  CR(SOAPY_SDR_F16, SOAPY_SDR_F32, priority, &prefix ## F16toF32<1>, features); \
+  CR(SOAPY_SDR_CF16, SOAPY_SDR_CF32, priority, &prefix ## F16toF32<2>, features); \
+  CR(SOAPY_SDR_S16, SOAPY_SDR_F16, priority, &prefix ## S16toF16<1>, intFeatures); \
+  CR(SOAPY_SDR_CS16, SOAPY_SDR_CF16, priority, &prefix ## S16toF16<2>, intFeatures); \
+  CR(SOAPY_SDR_F16, SOAPY_SDR_S16, priority, &prefix ## F16toS16<1>, intFeatures); \
+  CR(SOAPY_SDR_CF16, SOAPY_SDR_CS16, priority, &prefix ## F16toS16<2>, intFeatures);
+
+/*!
+ * Register the half precision converters between F16/CF16 and F32/CF32 and S16/CS16.
+ * Called from lateLoadDefaultConverters().
+ */
+void lateLoadHalfConverters(void)
+{
+  SOAPY_SDR_REGISTER_HALF(generic, CR::GENERIC, 0, 0)
+#ifdef SOAPY_SDR_CONVERTERS_X86
+  SOAPY_SDR_REGISTER_HALF(f16c, CR::VECTORIZED, CR::CPU_AVX | CR::CPU_F16C, CR::CPU_AVX2 | CR::CPU_F16C)
+  SOAPY_SDR_REGISTER_HALF(avx512, CR::VECTORIZED, CR::CPU_AVX512F, CR::CPU_AVX512F)
+#endif //SOAPY_SDR_CONVERTERS_X86
+}
@@ -0,0 +1,751 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// Converters for the packed complex formats.
+//
+// CS12/CU12 store one complex element in 3 bytes, I in the low 12 bits:
+//   byte0 = I[7:0], byte1 = Q[3:0] << 4 | I[11:8], byte2 = Q[11:4]
+// Unpacked values are left-justified into 16 bits so that a CS12 stream
+// and a CS16 stream share the same full scale.
+//
+// CS4/CU4 store one complex element in 1 byte, I in the low nibble:
+//   byte0 = Q[3:0] << 4 | I[3:0]
+// Unpacked values are left-justified into 8 bits, so CS4 shares the CS8 full scale.
+
+#include <SoapySDR/ConverterPrimitives.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include "VectorizedHelpers.hpp"
+#include <cstring> //memcpy
+
+// ********************************
+// 12-bit packing primitives
+
+static inline void unpack12(const uint8_t *in, uint16_t &i, uint16_t &q)
+{
+  i = uint16_t((uint16_t(in[1]) << 12) | (uint16_t(in[0]) << 4));
+  q = uint16_t((uint16_t(in[2]) << 8) | (in[1] & 0xf0));
+}
+
+static inline void pack12(const uint16_t i, const uint16_t q, uint8_t *out)
+{
+  out[0] = uint8_t(i >> 4);
+  out[1] = uint8_t((q & 0xf0) | (i >> 12));
+  out[2] = uint8_t(q >> 8);
+}
+
+//offset binary formats differ from two's complement by the sign bit
+template <bool isUnsigned>
+static inline uint16_t signOffset16(void)
+{
+  return isUnsigned?SoapySDR::U16_ZERO_OFFSET:0;
+}
+
+// ********************************
+// Generic 12-bit converters
+
+// CS12/CU12 > CS16
+template <bool isUnsigned>
+static void generic12toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t k = 0; k < numElems; k++)
+    {
+      uint16_t i, q;
+      unpack12(src+3*k, i, q);
+      dst[2*k+0] = int16_t(i ^ signOffset16<isUnsigned>()) * scaler;
+      dst[2*k+1] = int16_t(q ^ signOffset16<isUnsigned>()) * scaler;
+    }
+}
+
+// CS12/CU12 > CF32
+template <bool isUnsigned>
+static void generic12toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t k = 0; k < numElems; k++)
+    {
+      uint16_t i, q;
+      unpack12(src+3*k, i, q);
+      dst[2*k+0] = SoapySDR::S16toF32(int16_t(i ^ signOffset16<isUnsigned>())) * scaler;
+      dst[2*k+1] = SoapySDR::S16toF32(int16_t(q ^ signOffset16<isUnsigned>())) * scaler;
+    }
+}
+
+// CS16 > CS12/CU12
+template <bool isUnsigned>
+static void genericCS16to12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t k = 0; k < numElems; k++)
+    {
+      const uint16_t i = uint16_t(int16_t(src[2*k+0] * scaler)) ^ signOffset16<isUnsigned>();
+      const uint16_t q = uint16_t(int16_t(src[2*k+1] * scaler)) ^ signOffset16<isUnsigned>();
+      pack12(i, q, dst+3*k);
+    }
+}
+
+// CF32 > CS12/CU12
+template <bool isUnsigned>
+static void genericCF32to12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const float*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t k = 0; k < numElems; k++)
+    {
+      const uint16_t i = uint16_t(SoapySDR::F32toS16(src[2*k+0] * scaler)) ^ signOffset16<isUnsigned>();
+      const uint16_t q = uint16_t(SoapySDR::F32toS16(src[2*k+1] * scaler)) ^ signOffset16<isUnsigned>();
+      pack12(i, q, dst+3*k);
+    }
+}
+
+// ********************************
+// 4-bit packing primitives
+
+static inline void unpack4(const uint8_t in, uint8_t &i, uint8_t &q)
+{
+  i = uint8_t(in << 4);
+  q = uint8_t(in & 0xf0);
+}
+
+static inline uint8_t pack4(const uint8_t i, const uint8_t q)
+{
+  return uint8_t((i >> 4) | (q & 0xf0));
+}
+
+template <bool isUnsigned>
+static inline uint8_t signOffset8(void)
+{
+  return isUnsigned?SoapySDR::U8_ZERO_OFFSET:0;
+}
+
+// ********************************
+// Generic 4-bit converters
+
+// CS4/CU4 > CS8
+template <bool isUnsigned>
+static void generic4toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  for (size_t k = 0; k < numElems; k++)
+    {
+      uint8_t i, q;
+      unpack4(src[k], i, q);
+      dst[2*k+0] = int8_t(i ^ signOffset8<isUnsigned>()) * scaler;
+      dst[2*k+1] = int8_t(q ^ signOffset8<isUnsigned>()) * scaler;
+    }
+}
+
+// CS4/CU4 > CS16
+template <bool isUnsigned>
+static void generic4toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t k = 0; k < numElems; k++)
+    {
+      uint8_t i, q;
+      unpack4(src[k], i, q);
+      dst[2*k+0] = SoapySDR::S8toS16(int8_t(i ^ signOffset8<isUnsigned>())) * scaler;
+      dst[2*k+1] = SoapySDR::S8toS16(int8_t(q ^ signOffset8<isUnsigned>())) * scaler;
+    }
+}
+
+// CS4/CU4 > CF32
+template <bool isUnsigned>
+static void generic4toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t k = 0; k < numElems; k++)
+    {
+      uint8_t i, q;
+      unpack4(src[k], i, q);
+      dst[2*k+0] = SoapySDR::S8toF32(int8_t(i ^ signOffset8<isUnsigned>())) * scaler;
+      dst[2*k+1] = SoapySDR::S8toF32(int8_t(q ^ signOffset8<isUnsigned>())) * scaler;
+    }
+}
+
+// CS8 > CS4/CU4
+template <bool isUnsigned>
+static void genericCS8to4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const int8_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t k = 0; k < numElems; k++)
+    {
+      const uint8_t i = uint8_t(int8_t(src[2*k+0] * scaler)) ^ signOffset8<isUnsigned>();
+      const uint8_t q = uint8_t(int8_t(src[2*k+1] * scaler)) ^ signOffset8<isUnsigned>();
+      dst[k] = pack4(i, q);
+    }
+}
+
+// CS16 > CS4/CU4
+template <bool isUnsigned>
+static void genericCS16to4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t k = 0; k < numElems; k++)
+    {
+      const uint8_t i = uint8_t(SoapySDR::S16toS8(src[2*k+0] * scaler)) ^ signOffset8<isUnsigned>();
+      const uint8_t q = uint8_t(SoapySDR::S16toS8(src[2*k+1] * scaler)) ^ signOffset8<isUnsigned>();
+      dst[k] = pack4(i, q);
+    }
+}
+
+// CF32 > CS4/CU4
+template <bool isUnsigned>
+static void genericCF32to4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const float*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t k = 0; k < numElems; k++)
+    {
+      const uint8_t i = uint8_t(SoapySDR::F32toS8(src[2*k+0] * scaler)) ^ signOffset8<isUnsigned>();
+      const uint8_t q = uint8_t(SoapySDR::F32toS8(src[2*k+1] * scaler)) ^ signOffset8<isUnsigned>();
+      dst[k] = pack4(i, q);
+    }
+}
+
+#ifdef SOAPY_SDR_CONVERTERS_X86
+
+// ********************************
+// SSSE3 12-bit converters
+
+// 12 bytes -> 4 x complex int16 (loads 16 bytes)
+SOAPY_SDR_TARGET("ssse3")
+static inline __m128i ssse3Unpack12x4(const uint8_t *in, const __m128i offset)
+{
+  const __m128i shuffle = _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11);
+  const __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)in), shuffle);
+  const __m128i i = _mm_and_si128(_mm_slli_epi16(v, 4), _mm_set1_epi32(0x0000ffff));
+  const __m128i q = _mm_and_si128(v, _mm_set1_epi32(int(0xfff00000)));
+  return _mm_xor_si128(_mm_or_si128(i, q), offset);
+}
+
+// 4 x complex int16 -> 12 bytes
+SOAPY_SDR_TARGET("ssse3")
+static inline void ssse3Pack12x4(const __m128i in, const __m128i offset, uint8_t *out)
+{
+  const __m128i v = _mm_xor_si128(in, offset);
+  const __m128i i = _mm_srli_epi32(_mm_slli_epi32(v, 16), 20);
+  const __m128i q = _mm_srli_epi32(_mm_and_si128(v, _mm_set1_epi32(int(0xfff00000))), 8);
+  const __m128i shuffle = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+  const __m128i packed = _mm_shuffle_epi8(_mm_or_si128(i, q), shuffle);
+  _mm_storel_epi64((__m128i*)out, packed);
+  const int32_t last = _mm_cvtsi128_si32(_mm_srli_si128(packed, 8));
+  std::memcpy(out+8, &last, sizeof(last));
+}
+
+template <bool isUnsigned>
+SOAPY_SDR_TARGET("ssse3")
+static void ssse3_12toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  size_t k = 0;
+  if (scaler == 1.0)
+    {
+      const __m128i offset = _mm_set1_epi16(short(signOffset16<isUnsigned>()));
+      for (; k+6 <= numElems; k += 4)
+        {
+          _mm_storeu_si128((__m128i*)(dst+2*k), ssse3Unpack12x4(src+3*k, offset));
+        }
+    }
+  generic12toCS16<isUnsigned>(src+3*k, dst+2*k, numElems-k, scaler);
+}
+
+template <bool isUnsigned>
+SOAPY_SDR_TARGET("ssse3")
+static void ssse3_12toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  float f; size_t k = 0;
+  if (foldScaler(scaler, 1.0/SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      const __m128i offset = _mm_set1_epi16(short(signOffset16<isUnsigned>()));
+      for (; k+6 <= numElems; k += 4)
+        {
+          sse2S16toF32x8(ssse3Unpack12x4(src+3*k, offset), factor, dst+2*k);
+        }
+    }
+  generic12toCF32<isUnsigned>(src+3*k, dst+2*k, numElems-k, scaler);
+}
+
+template <bool isUnsigned>
+SOAPY_SDR_TARGET("ssse3")
+static void ssse3CS16to12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  size_t k = 0;
+  if (scaler == 1.0)
+    {
+      const __m128i offset = _mm_set1_epi16(short(signOffset16<isUnsigned>()));
+      for (; k+4 <= numElems; k += 4)
+        {
+          ssse3Pack12x4(_mm_loadu_si128((const __m128i*)(src+2*k)), offset, dst+3*k);
+        }
+    }
+  genericCS16to12<isUnsigned>(src+2*k, dst+3*k, numElems-k, scaler);
+}
+
+template <bool isUnsigned>
+SOAPY_SDR_TARGET("ssse3")
+static void ssse3CF32to12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const float*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  float f; size_t k = 0;
+  if (foldScaler(scaler, SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      const __m128i offset = _mm_set1_epi16(short(signOffset16<isUnsigned>()));
+      for (; k+4 <= numElems; k += 4)
+        {
+          ssse3Pack12x4(sse2F32toS16x8(src+2*k, factor), offset, dst+3*k);
+        }
+    }
+  genericCF32to12<isUnsigned>(src+2*k, dst+3*k, numElems-k, scaler);
+}
+
+// ********************************
+// AVX2 12-bit converters
+
+// 24 bytes -> 8 x complex int16 (loads 28 bytes)
+SOAPY_SDR_TARGET("avx2")
+static inline __m256i avx2Unpack12x8(const uint8_t *in, const __m256i offset)
+{
+  const __m256i shuffle = _mm256_setr_epi8(
+    0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11,
+    0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11);
+  const __m256i raw = _mm256_inserti128_si256(
+    _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(in+0))),
+    _mm_loadu_si128((const __m128i*)(in+12)), 1);
+  const __m256i v = _mm256_shuffle_epi8(raw, shuffle);
+  const __m256i i = _mm256_and_si256(_mm256_slli_epi16(v, 4), _mm256_set1_epi32(0x0000ffff));
+  const __m256i q = _mm256_and_si256(v, _mm256_set1_epi32(int(0xfff00000)));
+  return _mm256_xor_si256(_mm256_or_si256(i, q), offset);
+}
+
+// 8 x complex int16 -> 24 bytes
+SOAPY_SDR_TARGET("avx2")
+static inline void avx2Pack12x8(const __m256i in, const __m256i offset, uint8_t *out)
+{
+  const __m256i v = _mm256_xor_si256(in, offset);
+  const __m256i i = _mm256_srli_epi32(_mm256_slli_epi32(v, 16), 20);
+  const __m256i q = _mm256_srli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(int(0xfff00000))), 8);
+  const __m256i shuffle = _mm256_setr_epi8(
+    0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+    0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+  const __m256i packed = _mm256_shuffle_epi8(_mm256_or_si256(i, q), shuffle);
+  const __m128i lo = _mm256_castsi256_si128(packed);
+  const __m128i hi = _mm256_extracti128_si256(packed, 1);
+  const int32_t loLast = _mm_cvtsi128_si32(_mm_srli_si128(lo, 8));
+  const int32_t hiLast = _mm_cvtsi128_si32(_mm_srli_si128(hi, 8));
+  _mm_storel_epi64((__m128i*)(out+0), lo);
+  std::memcpy(out+8, &loLast, sizeof(loLast));
+  _mm_storel_epi64((__m128i*)(out+12), hi);
+  std::memcpy(out+20, &hiLast, sizeof(hiLast));
+}
+
+template <bool isUnsigned>
+SOAPY_SDR_TARGET("avx2")
+static void avx2_12toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  size_t k = 0;
+  if (scaler == 1.0)
+    {
+      const __m256i offset = _mm256_set1_epi16(short(signOffset16<isUnsigned>()));
+      for (; k+10 <= numElems; k += 8)
+        {
+          _mm256_storeu_si256((__m256i*)(dst+2*k), avx2Unpack12x8(src+3*k, offset));
+        }
+    }
+  generic12toCS16<isUnsigned>(src+3*k, dst+2*k, numElems-k, scaler);
+}
+
+template <bool isUnsigned>
+SOAPY_SDR_TARGET("avx2")
+static void avx2_12toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  float f; size_t k = 0;
+  if (foldScaler(scaler, 1.0/SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m256 factor = _mm256_set1_ps(f);
+      const __m256i offset = _mm256_set1_epi16(short(signOffset16<isUnsigned>()));
+      for (; k+10 <= numElems; k += 8)
+        {
+          const __m256i v = avx2Unpack12x8(src+3*k, offset);
+          const __m256i lo = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(v));
+          const __m256i hi = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(v, 1));
+          _mm256_storeu_ps(dst+2*k+0, _mm256_mul_ps(_mm256_cvtepi32_ps(lo), factor));
+          _mm256_storeu_ps(dst+2*k+8, _mm256_mul_ps(_mm256_cvtepi32_ps(hi), factor));
+        }
+    }
+  generic12toCF32<isUnsigned>(src+3*k, dst+2*k, numElems-k, scaler);
+}
+
+template <bool isUnsigned>
+SOAPY_SDR_TARGET("avx2")
+static void avx2CS16to12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  size_t k = 0;
+  if (scaler == 1.0)
+    {
+      const __m256i offset = _mm256_set1_epi16(short(signOffset16<isUnsigned>()));
+      for (; k+8 <= numElems; k += 8)
+        {
+          avx2Pack12x8(_mm256_loadu_si256((const __m256i*)(src+2*k)), offset, dst+3*k);
+        }
+    }
+  genericCS16to12<isUnsigned>(src+2*k, dst+3*k, numElems-k, scaler);
+}
+
+template <bool isUnsigned>
+SOAPY_SDR_TARGET("avx2")
+static void avx2CF32to12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const float*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  float f; size_t k = 0;
+  if (foldScaler(scaler, SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m256 factor = _mm256_set1_ps(f);
+      const __m256i offset = _mm256_set1_epi16(short(signOffset16<isUnsigned>()));
+      for (; k+8 <= numElems; k += 8)
+        {
+          avx2Pack12x8(avx2F32toS16x16(src+2*k, factor), offset, dst+3*k);
+        }
+    }
+  genericCF32to12<isUnsigned>(src+2*k, dst+3*k, numElems-k, scaler);
+}
+
+// ********************************
+// SSE2 4-bit converters
+
+// 16 bytes -> 2 x (8 x complex int8), left-justified nibbles
+SOAPY_SDR_TARGET("sse2")
+static inline void sse2Unpack4x16(const __m128i in, const __m128i offset, __m128i &lo, __m128i &hi)
+{
+  const __m128i nibble = _mm_set1_epi8(char(0xf0));
+  const __m128i i = _mm_and_si128(_mm_slli_epi16(in, 4), nibble);
+  const __m128i q = _mm_and_si128(in, nibble);
+  lo = _mm_xor_si128(_mm_unpacklo_epi8(i, q), offset);
+  hi = _mm_xor_si128(_mm_unpackhi_epi8(i, q), offset);
+}
+
+// 8 x complex int8 -> 8 bytes in the low half of each 16-bit lane
+SOAPY_SDR_TARGET("sse2")
+static inline __m128i sse2PackCS8to4x8(const __m128i in)
+{
+  const __m128i i = _mm_and_si128(_mm_srli_epi16(in, 4), _mm_set1_epi16(0x000f));
+  const __m128i q = _mm_and_si128(_mm_srli_epi16(in, 8), _mm_set1_epi16(0x00f0));
+  return _mm_or_si128(i, q);
+}
+
+// 4 x complex int16 -> 4 bytes in the low byte of each 32-bit lane
+SOAPY_SDR_TARGET("sse2")
+static inline __m128i sse2PackCS16to4x4(const __m128i in)
+{
+  const __m128i i = _mm_and_si128(_mm_srli_epi32(in, 12), _mm_set1_epi32(0x0000000f));
+  const __m128i q = _mm_and_si128(_mm_srli_epi32(in, 24), _mm_set1_epi32(0x000000f0));
+  return _mm_or_si128(i, q);
+}
+
+template <bool isUnsigned>
+SOAPY_SDR_TARGET("sse2")
+static void sse2_4toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  size_t k = 0;
+  if (scaler == 1.0)
+    {
+      const __m128i offset = _mm_set1_epi8(char(signOffset8<isUnsigned>()));
+      for (; k+16 <= numElems; k += 16)
+        {
+          __m128i lo, hi;
+          sse2Unpack4x16(_mm_loadu_si128((const __m128i*)(src+k)), offset, lo, hi);
+          _mm_storeu_si128((__m128i*)(dst+2*k+0), lo);
+          _mm_storeu_si128((__m128i*)(dst+2*k+16), hi);
+        }
+    }
+  generic4toCS8<isUnsigned>(src+k, dst+2*k, numElems-k, scaler);
+}
+
+template <bool isUnsigned>
+SOAPY_SDR_TARGET("sse2")
+static void sse2_4toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  size_t k = 0;
+  if (scaler == 1.0)
+    {
+      const __m128i offset = _mm_set1_epi8(char(signOffset8<isUnsigned>()));
+      const __m128i zero = _mm_setzero_si128();
+      for (; k+16 <= numElems; k += 16)
+        {
+          __m128i lo, hi;
+          sse2Unpack4x16(_mm_loadu_si128((const __m128i*)(src+k)), offset, lo, hi);
+          _mm_storeu_si128((__m128i*)(dst+2*k+0), _mm_unpacklo_epi8(zero, lo));
+          _mm_storeu_si128((__m128i*)(dst+2*k+8), _mm_unpackhi_epi8(zero, lo));
+          _mm_storeu_si128((__m128i*)(dst+2*k+16), _mm_unpacklo_epi8(zero, hi));
+          _mm_storeu_si128((__m128i*)(dst+2*k+24), _mm_unpackhi_epi8(zero, hi));
+        }
+    }
+  generic4toCS16<isUnsigned>(src+k, dst+2*k, numElems-k, scaler);
+}
+
+template <bool isUnsigned>
+SOAPY_SDR_TARGET("sse2")
+static void sse2_4toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  float f; size_t k = 0;
+  if (foldScaler(scaler, 1.0/SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      const __m128i offset = _mm_set1_epi8(char(signOffset8<isUnsigned>()));
+      const __m128i zero = _mm_setzero_si128();
+      for (; k+16 <= numElems; k += 16)
+        {
+          __m128i lo, hi;
+          sse2Unpack4x16(_mm_loadu_si128((const __m128i*)(src+k)), offset, lo, hi);
+          sse2S16toF32x8(_mm_unpacklo_epi8(zero, lo), factor, dst+2*k+0);
+          sse2S16toF32x8(_mm_unpackhi_epi8(zero, lo), factor, dst+2*k+8);
+          sse2S16toF32x8(_mm_unpacklo_epi8(zero, hi), factor, dst+2*k+16);
+          sse2S16toF32x8(_mm_unpackhi_epi8(zero, hi), factor, dst+2*k+24);
+        }
+    }
+  generic4toCF32<isUnsigned>(src+k, dst+2*k, numElems-k, scaler);
+}
+
+template <bool isUnsigned>
+SOAPY_SDR_TARGET("sse2")
+static void sse2CS8to4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const int8_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  size_t k = 0;
+  if (scaler == 1.0)
+    {
+      const __m128i offset = _mm_set1_epi8(char(0x11*(signOffset8<isUnsigned>() >> 4)));
+      for (; k+16 <= numElems; k += 16)
+        {
+          const __m128i lo = sse2PackCS8to4x8(_mm_loadu_si128((const __m128i*)(src+2*k+0)));
+          const __m128i hi = sse2PackCS8to4x8(_mm_loadu_si128((const __m128i*)(src+2*k+16)));
+          _mm_storeu_si128((__m128i*)(dst+k), _mm_xor_si128(_mm_packus_epi16(lo, hi), offset));
+        }
+    }
+  genericCS8to4<isUnsigned>(src+2*k, dst+k, numElems-k, scaler);
+}
+
+template <bool isUnsigned>
+SOAPY_SDR_TARGET("sse2")
+static void sse2CS16to4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  size_t k = 0;
+  if (scaler == 1.0)
+    {
+      const __m128i offset = _mm_set1_epi8(char(0x11*(signOffset8<isUnsigned>() >> 4)));
+      for (; k+16 <= numElems; k += 16)
+        {
+          __m128i v[4];
+          for (size_t j = 0; j < 4; j++)
+            {
+              v[j] = sse2PackCS16to4x4(_mm_loadu_si128((const __m128i*)(src+2*k+8*j)));
+            }
+          const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(v[0], v[1]), _mm_packs_epi32(v[2], v[3]));
+          _mm_storeu_si128((__m128i*)(dst+k), _mm_xor_si128(packed, offset));
+        }
+    }
+  genericCS16to4<isUnsigned>(src+2*k, dst+k, numElems-k, scaler);
+}
+
+template <bool isUnsigned>
+SOAPY_SDR_TARGET("sse2")
+static void sse2CF32to4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const float*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  float f; size_t k = 0;
+  if (foldScaler(scaler, SoapySDR::S8_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      const __m128i offset = _mm_set1_epi8(char(0x11*(signOffset8<isUnsigned>() >> 4)));
+      for (; k+16 <= numElems; k += 16)
+        {
+          const __m128i lo = sse2PackCS8to4x8(sse2F32toS8x16(src+2*k+0, factor));
+          const __m128i hi = sse2PackCS8to4x8(sse2F32toS8x16(src+2*k+16, factor));
+          _mm_storeu_si128((__m128i*)(dst+k), _mm_xor_si128(_mm_packus_epi16(lo, hi), offset));
+        }
+    }
+  genericCF32to4<isUnsigned>(src+2*k, dst+k, numElems-k, scaler);
+}
+
+// ********************************
+// AVX2 4-bit converters
+
+// 16 bytes -> 16 x complex int8, in order
+SOAPY_SDR_TARGET("avx2")
+static inline __m256i avx2Unpack4toCS8x16(const uint8_t *in, const __m256i offset)
+{
+  const __m256i v = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)in));
+  const __m256i i = _mm256_and_si256(_mm256_slli_epi16(v, 4), _mm256_set1_epi16(0x00f0));
+  const __m256i q = _mm256_and_si256(_mm256_slli_epi16(v, 8), _mm256_set1_epi16(short(0xf000)));
+  return _mm256_xor_si256(_mm256_or_si256(i, q), offset);
+}
+
+// 8 bytes -> 8 x complex int16, in order
+SOAPY_SDR_TARGET("avx2")
+static inline __m256i avx2Unpack4toCS16x8(const uint8_t *in, const __m256i offset)
+{
+  const __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)in));
+  const __m256i i = _mm256_and_si256(_mm256_slli_epi32(v, 12), _mm256_set1_epi32(0x0000f000));
+  const __m256i q = _mm256_and_si256(_mm256_slli_epi32(v, 24), _mm256_set1_epi32(int(0xf0000000)));
+  return _mm256_xor_si256(_mm256_or_si256(i, q), offset);
+}
+
+template <bool isUnsigned>
+SOAPY_SDR_TARGET("avx2")
+static void avx2_4toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  size_t k = 0;
+  if (scaler == 1.0)
+    {
+      const __m256i offset = _mm256_set1_epi8(char(signOffset8<isUnsigned>()));
+      for (; k+16 <= numElems; k += 16)
+        {
+          _mm256_storeu_si256((__m256i*)(dst+2*k), avx2Unpack4toCS8x16(src+k, offset));
+        }
+    }
+  generic4toCS8<isUnsigned>(src+k, dst+2*k, numElems-k, scaler);
+}
+
+template <bool isUnsigned>
+SOAPY_SDR_TARGET("avx2")
+static void avx2_4toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  size_t k = 0;
+  if (scaler == 1.0)
+    {
+      const __m256i offset = _mm256_set1_epi16(short(signOffset16<isUnsigned>()));
+      for (; k+8 <= numElems; k += 8)
+        {
+          _mm256_storeu_si256((__m256i*)(dst+2*k), avx2Unpack4toCS16x8(src+k, offset));
+        }
+    }
+  generic4toCS16<isUnsigned>(src+k, dst+2*k, numElems-k, scaler);
+}
+
+template <bool isUnsigned>
+SOAPY_SDR_TARGET("avx2")
+static void avx2_4toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  float f; size_t k = 0;
+  if (foldScaler(scaler, 1.0/SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m256 factor = _mm256_set1_ps(f);
+      const __m256i offset = _mm256_set1_epi16(short(signOffset16<isUnsigned>()));
+      for (; k+8 <= numElems; k += 8)
+        {
+          const __m256i v = avx2Unpack4toCS16x8(src+k, offset);
+          const __m256i lo = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(v));
+          const __m256i hi = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(v, 1));
+          _mm256_storeu_ps(dst+2*k+0, _mm256_mul_ps(_mm256_cvtepi32_ps(lo), factor));
+          _mm256_storeu_ps(dst+2*k+8, _mm256_mul_ps(_mm256_cvtepi32_ps(hi), factor));
+        }
+    }
+  generic4toCF32<isUnsigned>(src+k, dst+2*k, numElems-k, scaler);
+}
+
+#endif //SOAPY_SDR_CONVERTERS_X86
+
+/*!
+ * Register the packed format converters.
+ * Called from lateLoadDefaultConverters().
+ */
+void lateLoadPackedConverters(void)
+{
+  static SoapySDR::ConverterRegistry registerGenericCS12toCS16(SOAPY_SDR_CS12, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &generic12toCS16<false>);
+  static SoapySDR::ConverterRegistry registerGenericCU12toCS16(SOAPY_SDR_CU12, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &generic12toCS16<true>);
+  static SoapySDR::ConverterRegistry registerGenericCS12toCF32(SOAPY_SDR_CS12, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &generic12toCF32<false>);
+  static SoapySDR::ConverterRegistry registerGenericCU12toCF32(SOAPY_SDR_CU12, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &generic12toCF32<true>);
+  static SoapySDR::ConverterRegistry registerGenericCS16toCS12(SOAPY_SDR_CS16, SOAPY_SDR_CS12, SoapySDR::ConverterRegistry::GENERIC, &genericCS16to12<false>);
+  static SoapySDR::ConverterRegistry registerGenericCS16toCU12(SOAPY_SDR_CS16, SOAPY_SDR_CU12, SoapySDR::ConverterRegistry::GENERIC, &genericCS16to12<true>);
+  static SoapySDR::ConverterRegistry registerGenericCF32toCS12(SOAPY_SDR_CF32, SOAPY_SDR_CS12, SoapySDR::ConverterRegistry::GENERIC, &genericCF32to12<false>);
+  static SoapySDR::ConverterRegistry registerGenericCF32toCU12(SOAPY_SDR_CF32, SOAPY_SDR_CU12, SoapySDR::ConverterRegistry::GENERIC, &genericCF32to12<true>);
+
+  static SoapySDR::ConverterRegistry registerGenericCS4toCS8(SOAPY_SDR_CS4, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &generic4toCS8<false>);
+  static SoapySDR::ConverterRegistry registerGenericCS4toCS16(SOAPY_SDR_CS4, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &generic4toCS16<false>);
+  static SoapySDR::ConverterRegistry registerGenericCS4toCF32(SOAPY_SDR_CS4, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &generic4toCF32<false>);
+  static SoapySDR::ConverterRegistry registerGenericCU4toCS8(SOAPY_SDR_CU4, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &generic4toCS8<true>);
+  static SoapySDR::ConverterRegistry registerGenericCU4toCS16(SOAPY_SDR_CU4, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &generic4toCS16<true>);
+  static SoapySDR::ConverterRegistry registerGenericCU4toCF32(SOAPY_SDR_CU4, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &generic4toCF32<true>);
+  static SoapySDR::ConverterRegistry registerGenericCS8toCS4(SOAPY_SDR_CS8, SOAPY_SDR_CS4, SoapySDR::ConverterRegistry::GENERIC, &genericCS8to4<false>);
+  static SoapySDR::ConverterRegistry registerGenericCS16toCS4(SOAPY_SDR_CS16, SOAPY_SDR_CS4, SoapySDR::ConverterRegistry::GENERIC, &genericCS16to4<false>);
+  static SoapySDR::ConverterRegistry registerGenericCF32toCS4(SOAPY_SDR_CF32, SOAPY_SDR_CS4, SoapySDR::ConverterRegistry::GENERIC, &genericCF32to4<false>);
+  static SoapySDR::ConverterRegistry registerGenericCS8toCU4(SOAPY_SDR_CS8, SOAPY_SDR_CU4, SoapySDR::ConverterRegistry::GENERIC, &genericCS8to4<true>);
+  static SoapySDR::ConverterRegistry registerGenericCS16toCU4(SOAPY_SDR_CS16, SOAPY_SDR_CU4, SoapySDR::ConverterRegistry::GENERIC, &genericCS16to4<true>);
+  static SoapySDR::ConverterRegistry registerGenericCF32toCU4(SOAPY_SDR_CF32, SOAPY_SDR_CU4, SoapySDR::ConverterRegistry::GENERIC, &genericCF32to4<true>);
+
+#ifdef SOAPY_SDR_CONVERTERS_X86
+  static SoapySDR::ConverterRegistry registerSSSE3CS12toCS16(SOAPY_SDR_CS12, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &ssse3_12toCS16<false>, SoapySDR::ConverterRegistry::CPU_SSSE3);
+  static SoapySDR::ConverterRegistry registerSSSE3CU12toCS16(SOAPY_SDR_CU12, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &ssse3_12toCS16<true>, SoapySDR::ConverterRegistry::CPU_SSSE3);
+  static SoapySDR::ConverterRegistry registerSSSE3CS12toCF32(SOAPY_SDR_CS12, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &ssse3_12toCF32<false>, SoapySDR::ConverterRegistry::CPU_SSSE3);
+  static SoapySDR::ConverterRegistry registerSSSE3CU12toCF32(SOAPY_SDR_CU12, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &ssse3_12toCF32<true>, SoapySDR::ConverterRegistry::CPU_SSSE3);
+  static SoapySDR::ConverterRegistry registerSSSE3CS16toCS12(SOAPY_SDR_CS16, SOAPY_SDR_CS12, SoapySDR::ConverterRegistry::VECTORIZED, &ssse3CS16to12<false>, SoapySDR::ConverterRegistry::CPU_SSSE3);
+  static SoapySDR::ConverterRegistry registerSSSE3CS16toCU12(SOAPY_SDR_CS16, SOAPY_SDR_CU12, SoapySDR::ConverterRegistry::VECTORIZED, &ssse3CS16to12<true>, SoapySDR::ConverterRegistry::CPU_SSSE3);
+  static SoapySDR::ConverterRegistry registerSSSE3CF32toCS12(SOAPY_SDR_CF32, SOAPY_SDR_CS12, SoapySDR::ConverterRegistry::VECTORIZED, &ssse3CF32to12<false>, SoapySDR::ConverterRegistry::CPU_SSSE3);
+  static SoapySDR::ConverterRegistry registerSSSE3CF32toCU12(SOAPY_SDR_CF32, SOAPY_SDR_CU12, SoapySDR::ConverterRegistry::VECTORIZED, &ssse3CF32to12<true>, SoapySDR::ConverterRegistry::CPU_SSSE3);
+  static SoapySDR::ConverterRegistry registerAVX2CS12toCS16(SOAPY_SDR_CS12, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2_12toCS16<false>, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerAVX2CU12toCS16(SOAPY_SDR_CU12, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2_12toCS16<true>, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerAVX2CS12toCF32(SOAPY_SDR_CS12, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2_12toCF32<false>, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerAVX2CU12toCF32(SOAPY_SDR_CU12, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2_12toCF32<true>, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerAVX2CS16toCS12(SOAPY_SDR_CS16, SOAPY_SDR_CS12, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CS16to12<false>, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerAVX2CS16toCU12(SOAPY_SDR_CS16, SOAPY_SDR_CU12, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CS16to12<true>, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerAVX2CF32toCS12(SOAPY_SDR_CF32, SOAPY_SDR_CS12, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF32to12<false>, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerAVX2CF32toCU12(SOAPY_SDR_CF32, SOAPY_SDR_CU12, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF32to12<true>, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerSSE2CS4toCS8(SOAPY_SDR_CS4, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::VECTORIZED, &sse2_4toCS8<false>, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerSSE2CS4toCS16(SOAPY_SDR_CS4, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &sse2_4toCS16<false>, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerSSE2CS4toCF32(SOAPY_SDR_CS4, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2_4toCF32<false>, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerSSE2CS8toCS4(SOAPY_SDR_CS8, SOAPY_SDR_CS4, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS8to4<false>, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerSSE2CS16toCS4(SOAPY_SDR_CS16, SOAPY_SDR_CS4, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS16to4<false>, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerSSE2CF32toCS4(SOAPY_SDR_CF32, SOAPY_SDR_CS4, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF32to4<false>, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerAVX2CS4toCS8(SOAPY_SDR_CS4, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::VECTORIZED, &avx2_4toCS8<false>, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerAVX2CS4toCS16(SOAPY_SDR_CS4, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2_4toCS16<false>, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerAVX2CS4toCF32(SOAPY_SDR_CS4, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2_4toCF32<false>, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerSSE2CU4toCS8(SOAPY_SDR_CU4, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::VECTORIZED, &sse2_4toCS8<true>, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerSSE2CU4toCS16(SOAPY_SDR_CU4, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &sse2_4toCS16<true>, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerSSE2CU4toCF32(SOAPY_SDR_CU4, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2_4toCF32<true>, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerSSE2CS8toCU4(SOAPY_SDR_CS8, SOAPY_SDR_CU4, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS8to4<true>, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerSSE2CS16toCU4(SOAPY_SDR_CS16, SOAPY_SDR_CU4, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS16to4<true>, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerSSE2CF32toCU4(SOAPY_SDR_CF32, SOAPY_SDR_CU4, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF32to4<true>, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerAVX2CU4toCS8(SOAPY_SDR_CU4, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::VECTORIZED, &avx2_4toCS8<true>, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerAVX2CU4toCS16(SOAPY_SDR_CU4, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2_4toCS16<true>, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerAVX2CU4toCF32(SOAPY_SDR_CU4, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2_4toCF32<true>, SoapySDR::ConverterRegistry::CPU_AVX2);
+#endif //SOAPY_SDR_CONVERTERS_X86
+}
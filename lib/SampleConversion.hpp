@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <SoapySDR/ConverterPrimitives.hpp>
+#include <SoapySDR/Formats.h>
+#include <type_traits>
+
+// ********************************
+// Sample conversion table
+//
+// Sample<From, To>::convert() maps a single real sample
+// between two formats using the converter primitives.
+
+template <typename From, typename To>
+struct Sample;
+
+template <typename T>
+struct Sample<T, T>
+{
+  static inline T convert(const T from){ return from; }
+};
+
+#define SOAPY_SDR_SAMPLE_PRIMITIVE(From, To, primitive) \
+  template <> struct Sample<From, To> \
+  { \
+    static inline To convert(const From from){ return SoapySDR::primitive(from); } \
+  };
+
+SOAPY_SDR_SAMPLE_PRIMITIVE(double, float, F64toF32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(double, int32_t, F64toS32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(double, uint32_t, F64toU32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(double, int16_t, F64toS16)
+SOAPY_SDR_SAMPLE_PRIMITIVE(double, uint16_t, F64toU16)
+SOAPY_SDR_SAMPLE_PRIMITIVE(double, int8_t, F64toS8)
+SOAPY_SDR_SAMPLE_PRIMITIVE(double, uint8_t, F64toU8)
+
+SOAPY_SDR_SAMPLE_PRIMITIVE(float, double, F32toF64)
+SOAPY_SDR_SAMPLE_PRIMITIVE(float, int32_t, F32toS32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(float, uint32_t, F32toU32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(float, int16_t, F32toS16)
+SOAPY_SDR_SAMPLE_PRIMITIVE(float, uint16_t, F32toU16)
+SOAPY_SDR_SAMPLE_PRIMITIVE(float, int8_t, F32toS8)
+SOAPY_SDR_SAMPLE_PRIMITIVE(float, uint8_t, F32toU8)
+
+SOAPY_SDR_SAMPLE_PRIMITIVE(int32_t, double, S32toF64)
+SOAPY_SDR_SAMPLE_PRIMITIVE(int32_t, float, S32toF32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(int32_t, uint32_t, S32toU32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(int32_t, int16_t, S32toS16)
+SOAPY_SDR_SAMPLE_PRIMITIVE(int32_t, uint16_t, S32toU16)
+SOAPY_SDR_SAMPLE_PRIMITIVE(int32_t, int8_t, S32toS8)
+SOAPY_SDR_SAMPLE_PRIMITIVE(int32_t, uint8_t, S32toU8)
+
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint32_t, double, U32toF64)
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint32_t, float, U32toF32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint32_t, int32_t, U32toS32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint32_t, int16_t, U32toS16)
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint32_t, uint16_t, U32toU16)
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint32_t, int8_t, U32toS8)
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint32_t, uint8_t, U32toU8)
+
+SOAPY_SDR_SAMPLE_PRIMITIVE(int16_t, double, S16toF64)
+SOAPY_SDR_SAMPLE_PRIMITIVE(int16_t, float, S16toF32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(int16_t, int32_t, S16toS32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(int16_t, uint32_t, S16toU32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(int16_t, uint16_t, S16toU16)
+SOAPY_SDR_SAMPLE_PRIMITIVE(int16_t, int8_t, S16toS8)
+SOAPY_SDR_SAMPLE_PRIMITIVE(int16_t, uint8_t, S16toU8)
+
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint16_t, double, U16toF64)
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint16_t, float, U16toF32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint16_t, int32_t, U16toS32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint16_t, uint32_t, U16toU32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint16_t, int16_t, U16toS16)
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint16_t, int8_t, U16toS8)
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint16_t, uint8_t, U16toU8)
+
+SOAPY_SDR_SAMPLE_PRIMITIVE(int8_t, double, S8toF64)
+SOAPY_SDR_SAMPLE_PRIMITIVE(int8_t, float, S8toF32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(int8_t, int32_t, S8toS32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(int8_t, uint32_t, S8toU32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(int8_t, int16_t, S8toS16)
+SOAPY_SDR_SAMPLE_PRIMITIVE(int8_t, uint16_t, S8toU16)
+SOAPY_SDR_SAMPLE_PRIMITIVE(int8_t, uint8_t, S8toU8)
+
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint8_t, double, U8toF64)
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint8_t, float, U8toF32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint8_t, int32_t, U8toS32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint8_t, uint32_t, U8toU32)
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint8_t, int16_t, U8toS16)
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint8_t, uint16_t, U8toU16)
+SOAPY_SDR_SAMPLE_PRIMITIVE(uint8_t, int8_t, U8toS8)
+
+/*!
+ * Where to apply the scaler for a given conversion.
+ * The scaler is applied to the source sample when the conversion narrows
+ * (including float to integer), and to the converted sample otherwise.
+ * Between integers of the same width it is applied on the signed side.
+ */
+template <typename From, typename To>
+struct ScaleBeforeConvert
+{
+  static const bool value =
+    std::is_floating_point<From>::value?(sizeof(To) <= sizeof(From)):
+    std::is_floating_point<To>::value?false:
+    (sizeof(To) < sizeof(From) or (sizeof(To) == sizeof(From) and std::is_signed<From>::value));
+};
+
+/*!
+ * Convert and scale one sample like the generic converters do.
+ * Converters hoist the scaler checks out of their loops,
+ * this is for kernels that handle one sample at a time.
+ */
+template <typename From, typename To>
+static inline To scaleSample(const From from, const double scaler)
+{
+  if (scaler == 1.0) return Sample<From, To>::convert(from);
+  if (ScaleBeforeConvert<From, To>::value) return Sample<From, To>::convert(From(from * scaler));
+  return To(Sample<From, To>::convert(from) * scaler);
+}
+
+// ********************************
+// Format declarations
+
+#define SOAPY_SDR_FORMAT_TYPE(name, type, realFormat, complexFormat) \
+  struct name \
+  { \
+    typedef type Type; \
+    static const char *real(void){ return realFormat; } \
+    static const char *complex(void){ return complexFormat; } \
+  };
+
+SOAPY_SDR_FORMAT_TYPE(FormatF64, double, SOAPY_SDR_F64, SOAPY_SDR_CF64)
+SOAPY_SDR_FORMAT_TYPE(FormatF32, float, SOAPY_SDR_F32, SOAPY_SDR_CF32)
+SOAPY_SDR_FORMAT_TYPE(FormatS32, int32_t, SOAPY_SDR_S32, SOAPY_SDR_CS32)
+SOAPY_SDR_FORMAT_TYPE(FormatU32, uint32_t, SOAPY_SDR_U32, SOAPY_SDR_CU32)
+SOAPY_SDR_FORMAT_TYPE(FormatS16, int16_t, SOAPY_SDR_S16, SOAPY_SDR_CS16)
+SOAPY_SDR_FORMAT_TYPE(FormatU16, uint16_t, SOAPY_SDR_U16, SOAPY_SDR_CU16)
+SOAPY_SDR_FORMAT_TYPE(FormatS8, int8_t, SOAPY_SDR_S8, SOAPY_SDR_CS8)
+SOAPY_SDR_FORMAT_TYPE(FormatU8, uint8_t, SOAPY_SDR_U8, SOAPY_SDR_CU8)
+
+template <typename... Formats>
+struct FormatList {};
+
+typedef FormatList<
+  FormatF64, FormatF32,
+  FormatS32, FormatU32,
+  FormatS16, FormatU16,
+  FormatS8, FormatU8> DefaultFormats;
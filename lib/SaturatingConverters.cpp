@@ -0,0 +1,251 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// Rounding and saturating float to integer converters for transmit paths.
+// The vectorized kernels clamp the positive side in float, round with the
+// default rounding conversion, and let the signed packs saturate to the target width,
+// so they cost about the same as the truncating kernels in VectorizedConverters.cpp.
+// Each kernel is bit-exact with the generic converter built on the *Sat primitives.
+
+#include <SoapySDR/ConverterPrimitives.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include "VectorizedHelpers.hpp"
+
+typedef SoapySDR::ConverterRegistry CR;
+
+// ********************************
+// Generic converters
+
+template <typename From, typename To, To (*convert)(From)>
+static void scalarSaturate(const From *src, To *dst, const size_t n, const double scaler)
+{
+  if (scaler == 1.0)
+    {
+      for (size_t i = 0; i < n; i++) dst[i] = convert(src[i]);
+    }
+  else
+    {
+      for (size_t i = 0; i < n; i++) dst[i] = convert(From(src[i] * scaler));
+    }
+}
+
+template <typename From, typename To, To (*convert)(From), size_t elemDepth>
+static void genericSaturate(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  scalarSaturate<From, To, convert>((const From *)srcBuff, (To *)dstBuff, numElems*elemDepth, scaler);
+}
+
+#ifdef SOAPY_SDR_CONVERTERS_X86
+
+// ********************************
+// SSE2 kernels
+
+template <size_t elemDepth>
+SOAPY_SDR_TARGET("sse2")
+static void sse2F32toS16Sat(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      for (; i+8 <= n; i += 8)
+        {
+          _mm_storeu_si128((__m128i*)(dst+i), sse2F32toS16Satx8(src+i, factor));
+        }
+    }
+  scalarSaturate<float, int16_t, SoapySDR::F32toS16Sat>(src+i, dst+i, n-i, scaler);
+}
+
+template <size_t elemDepth>
+SOAPY_SDR_TARGET("sse2")
+static void sse2F32toU16Sat(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      const __m128i offset = _mm_set1_epi16(short(SoapySDR::U16_ZERO_OFFSET));
+      for (; i+8 <= n; i += 8)
+        {
+          _mm_storeu_si128((__m128i*)(dst+i), _mm_xor_si128(sse2F32toS16Satx8(src+i, factor), offset));
+        }
+    }
+  scalarSaturate<float, uint16_t, SoapySDR::F32toU16Sat>(src+i, dst+i, n-i, scaler);
+}
+
+template <size_t elemDepth>
+SOAPY_SDR_TARGET("sse2")
+static void sse2F32toS8Sat(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S8_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      for (; i+16 <= n; i += 16)
+        {
+          _mm_storeu_si128((__m128i*)(dst+i), sse2F32toS8Satx16(src+i, factor));
+        }
+    }
+  scalarSaturate<float, int8_t, SoapySDR::F32toS8Sat>(src+i, dst+i, n-i, scaler);
+}
+
+template <size_t elemDepth>
+SOAPY_SDR_TARGET("sse2")
+static void sse2F32toU8Sat(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S8_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      const __m128i offset = _mm_set1_epi8(char(SoapySDR::U8_ZERO_OFFSET));
+      for (; i+16 <= n; i += 16)
+        {
+          _mm_storeu_si128((__m128i*)(dst+i), _mm_xor_si128(sse2F32toS8Satx16(src+i, factor), offset));
+        }
+    }
+  scalarSaturate<float, uint8_t, SoapySDR::F32toU8Sat>(src+i, dst+i, n-i, scaler);
+}
+
+// ********************************
+// AVX2 kernels
+
+template <size_t elemDepth>
+SOAPY_SDR_TARGET("avx2")
+static void avx2F32toS16Sat(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m256 factor = _mm256_set1_ps(f);
+      for (; i+16 <= n; i += 16)
+        {
+          _mm256_storeu_si256((__m256i*)(dst+i), avx2F32toS16Satx16(src+i, factor));
+        }
+    }
+  scalarSaturate<float, int16_t, SoapySDR::F32toS16Sat>(src+i, dst+i, n-i, scaler);
+}
+
+template <size_t elemDepth>
+SOAPY_SDR_TARGET("avx2")
+static void avx2F32toU16Sat(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m256 factor = _mm256_set1_ps(f);
+      const __m256i offset = _mm256_set1_epi16(short(SoapySDR::U16_ZERO_OFFSET));
+      for (; i+16 <= n; i += 16)
+        {
+          _mm256_storeu_si256((__m256i*)(dst+i), _mm256_xor_si256(avx2F32toS16Satx16(src+i, factor), offset));
+        }
+    }
+  scalarSaturate<float, uint16_t, SoapySDR::F32toU16Sat>(src+i, dst+i, n-i, scaler);
+}
+
+template <size_t elemDepth>
+SOAPY_SDR_TARGET("avx2")
+static void avx2F32toS8Sat(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S8_FULL_SCALE, f))
+    {
+      const __m256 factor = _mm256_set1_ps(f);
+      for (; i+32 <= n; i += 32)
+        {
+          _mm256_storeu_si256((__m256i*)(dst+i), avx2F32toS8Satx32(src+i, factor));
+        }
+    }
+  scalarSaturate<float, int8_t, SoapySDR::F32toS8Sat>(src+i, dst+i, n-i, scaler);
+}
+
+template <size_t elemDepth>
+SOAPY_SDR_TARGET("avx2")
+static void avx2F32toU8Sat(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*elemDepth;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S8_FULL_SCALE, f))
+    {
+      const __m256 factor = _mm256_set1_ps(f);
+      const __m256i offset = _mm256_set1_epi8(char(SoapySDR::U8_ZERO_OFFSET));
+      for (; i+32 <= n; i += 32)
+        {
+          _mm256_storeu_si256((__m256i*)(dst+i), _mm256_xor_si256(avx2F32toS8Satx32(src+i, factor), offset));
+        }
+    }
+  scalarSaturate<float, uint8_t, SoapySDR::F32toU8Sat>(src+i, dst+i, n-i, scaler);
+}
+
+#endif //SOAPY_SDR_CONVERTERS_X86
+
+// ********************************
+// Registration
+
+template <typename From, typename To, To (*convert)(From)>
+static void registerGenericSaturating(const char *realSource, const char *complexSource, const char *realTarget, const char *complexTarget)
+{
+  CR::registerSaturatingFunction(realSource, realTarget, CR::GENERIC, &genericSaturate<From, To, convert, 1>);
+  CR::registerSaturatingFunction(complexSource, complexTarget, CR::GENERIC, &genericSaturate<From, To, convert, 2>);
+}
+
+/*!
+ * Register the saturating converters from the float formats to every integer format.
+ * Called from lateLoadDefaultConverters().
+ */
+void lateLoadSaturatingConverters(void)
+{
+  registerGenericSaturating<float, int32_t, SoapySDR::F32toS32Sat>(SOAPY_SDR_F32, SOAPY_SDR_CF32, SOAPY_SDR_S32, SOAPY_SDR_CS32);
+  registerGenericSaturating<float, uint32_t, SoapySDR::F32toU32Sat>(SOAPY_SDR_F32, SOAPY_SDR_CF32, SOAPY_SDR_U32, SOAPY_SDR_CU32);
+  registerGenericSaturating<float, int16_t, SoapySDR::F32toS16Sat>(SOAPY_SDR_F32, SOAPY_SDR_CF32, SOAPY_SDR_S16, SOAPY_SDR_CS16);
+  registerGenericSaturating<float, uint16_t, SoapySDR::F32toU16Sat>(SOAPY_SDR_F32, SOAPY_SDR_CF32, SOAPY_SDR_U16, SOAPY_SDR_CU16);
+  registerGenericSaturating<float, int8_t, SoapySDR::F32toS8Sat>(SOAPY_SDR_F32, SOAPY_SDR_CF32, SOAPY_SDR_S8, SOAPY_SDR_CS8);
+  registerGenericSaturating<float, uint8_t, SoapySDR::F32toU8Sat>(SOAPY_SDR_F32, SOAPY_SDR_CF32, SOAPY_SDR_U8, SOAPY_SDR_CU8);
+  registerGenericSaturating<double, int32_t, SoapySDR::F64toS32Sat>(SOAPY_SDR_F64, SOAPY_SDR_CF64, SOAPY_SDR_S32, SOAPY_SDR_CS32);
+  registerGenericSaturating<double, uint32_t, SoapySDR::F64toU32Sat>(SOAPY_SDR_F64, SOAPY_SDR_CF64, SOAPY_SDR_U32, SOAPY_SDR_CU32);
+  registerGenericSaturating<double, int16_t, SoapySDR::F64toS16Sat>(SOAPY_SDR_F64, SOAPY_SDR_CF64, SOAPY_SDR_S16, SOAPY_SDR_CS16);
+  registerGenericSaturating<double, uint16_t, SoapySDR::F64toU16Sat>(SOAPY_SDR_F64, SOAPY_SDR_CF64, SOAPY_SDR_U16, SOAPY_SDR_CU16);
+  registerGenericSaturating<double, int8_t, SoapySDR::F64toS8Sat>(SOAPY_SDR_F64, SOAPY_SDR_CF64, SOAPY_SDR_S8, SOAPY_SDR_CS8);
+  registerGenericSaturating<double, uint8_t, SoapySDR::F64toU8Sat>(SOAPY_SDR_F64, SOAPY_SDR_CF64, SOAPY_SDR_U8, SOAPY_SDR_CU8);
+
+#ifdef SOAPY_SDR_CONVERTERS_X86
+  CR::registerSaturatingFunction(SOAPY_SDR_F32, SOAPY_SDR_S16, CR::VECTORIZED, &sse2F32toS16Sat<1>, CR::CPU_SSE2);
+  CR::registerSaturatingFunction(SOAPY_SDR_CF32, SOAPY_SDR_CS16, CR::VECTORIZED, &sse2F32toS16Sat<2>, CR::CPU_SSE2);
+  CR::registerSaturatingFunction(SOAPY_SDR_F32, SOAPY_SDR_U16, CR::VECTORIZED, &sse2F32toU16Sat<1>, CR::CPU_SSE2);
+  CR::registerSaturatingFunction(SOAPY_SDR_CF32, SOAPY_SDR_CU16, CR::VECTORIZED, &sse2F32toU16Sat<2>, CR::CPU_SSE2);
+  CR::registerSaturatingFunction(SOAPY_SDR_F32, SOAPY_SDR_S8, CR::VECTORIZED, &sse2F32toS8Sat<1>, CR::CPU_SSE2);
+  CR::registerSaturatingFunction(SOAPY_SDR_CF32, SOAPY_SDR_CS8, CR::VECTORIZED, &sse2F32toS8Sat<2>, CR::CPU_SSE2);
+  CR::registerSaturatingFunction(SOAPY_SDR_F32, SOAPY_SDR_U8, CR::VECTORIZED, &sse2F32toU8Sat<1>, CR::CPU_SSE2);
+  CR::registerSaturatingFunction(SOAPY_SDR_CF32, SOAPY_SDR_CU8, CR::VECTORIZED, &sse2F32toU8Sat<2>, CR::CPU_SSE2);
+  CR::registerSaturatingFunction(SOAPY_SDR_F32, SOAPY_SDR_S16, CR::VECTORIZED, &avx2F32toS16Sat<1>, CR::CPU_AVX2);
+  CR::registerSaturatingFunction(SOAPY_SDR_CF32, SOAPY_SDR_CS16, CR::VECTORIZED, &avx2F32toS16Sat<2>, CR::CPU_AVX2);
+  CR::registerSaturatingFunction(SOAPY_SDR_F32, SOAPY_SDR_U16, CR::VECTORIZED, &avx2F32toU16Sat<1>, CR::CPU_AVX2);
+  CR::registerSaturatingFunction(SOAPY_SDR_CF32, SOAPY_SDR_CU16, CR::VECTORIZED, &avx2F32toU16Sat<2>, CR::CPU_AVX2);
+  CR::registerSaturatingFunction(SOAPY_SDR_F32, SOAPY_SDR_S8, CR::VECTORIZED, &avx2F32toS8Sat<1>, CR::CPU_AVX2);
+  CR::registerSaturatingFunction(SOAPY_SDR_CF32, SOAPY_SDR_CS8, CR::VECTORIZED, &avx2F32toS8Sat<2>, CR::CPU_AVX2);
+  CR::registerSaturatingFunction(SOAPY_SDR_F32, SOAPY_SDR_U8, CR::VECTORIZED, &avx2F32toU8Sat<1>, CR::CPU_AVX2);
+  CR::registerSaturatingFunction(SOAPY_SDR_CF32, SOAPY_SDR_CU8, CR::VECTORIZED, &avx2F32toU8Sat<2>, CR::CPU_AVX2);
+#endif //SOAPY_SDR_CONVERTERS_X86
+}
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <cstddef>
+
+/***********************************************************************
+ * Copy-on-write storage shared by the converter registries.
+ *
+ * Lookups read an immutable snapshot through an atomic pointer and never lock.
+ * Registrations copy the current snapshot under the writer mutex,
+ * modify the copy, and publish it when the outermost batch ends,
+ * so bulk registration publishes a single snapshot.
+ *
+ * Readers announce themselves in a counter before loading the pointer.
+ * A replaced snapshot is retired, and the retired snapshots are freed
+ * by the first publish that finds no reader active. Every access is
+ * sequentially consistent, so a reader that the publish does not see
+ * loads the new pointer and can not hold a retired snapshot.
+ **********************************************************************/
+template <typename Snapshot>
+class SnapshotRegistry
+{
+public:
+  //! Holds the snapshot that was current on construction until destruction
+  class Reader
+  {
+  public:
+    Reader(const SnapshotRegistry &registry):
+      _registry(&registry)
+    {
+      _registry->_numReaders.fetch_add(1);
+      const Snapshot *snapshot = _registry->_published.load();
+      _snapshot = (snapshot == nullptr)?&emptySnapshot():snapshot;
+    }
+
+    Reader(Reader &&other):
+      _registry(other._registry),
+      _snapshot(other._snapshot)
+    {
+      other._registry = nullptr;
+    }
+
+    ~Reader(void)
+    {
+      if (_registry != nullptr) _registry->_numReaders.fetch_sub(1);
+    }
+
+    const Snapshot &operator*(void) const
+    {
+      return *_snapshot;
+    }
+
+    const Snapshot *operator->(void) const
+    {
+      return _snapshot;
+    }
+
+  private:
+    Reader(const Reader &);
+    Reader &operator=(const Reader &);
+    const SnapshotRegistry *_registry;
+    const Snapshot *_snapshot;
+  };
+
+  SnapshotRegistry(void):
+    _published(nullptr),
+    _numReaders(0),
+    _pending(nullptr),
+    _depth(0),
+    _modified(false)
+  {
+    return;
+  }
+
+  Reader read(void) const
+  {
+    return Reader(*this);
+  }
+
+  /*!
+   * Open a registration batch on the calling thread.
+   * Other writers block until the matching end().
+   * \return the pending copy to modify, see markModified()
+   */
+  Snapshot &begin(void)
+  {
+    _mutex.lock();
+    if (_depth++ == 0)
+      {
+        const Snapshot *snapshot = _published.load();
+        _pending = new Snapshot((snapshot == nullptr)?emptySnapshot():*snapshot);
+        _modified = false;
+      }
+    return *_pending;
+  }
+
+  //! The pending copy of the open batch
+  Snapshot &pending(void)
+  {
+    return *_pending;
+  }
+
+  //! Publish the pending copy when the batch ends, an unmodified copy is dropped
+  void markModified(void)
+  {
+    _modified = true;
+  }
+
+  //! Close a registration batch and publish its registrations
+  void end(void)
+  {
+    if (--_depth == 0)
+      {
+        if (_modified)
+          {
+            const Snapshot *replaced = _published.exchange(_pending);
+            if (replaced != nullptr) _retired.push_back(replaced);
+          }
+        else delete _pending;
+        _pending = nullptr;
+
+        if (_numReaders.load() == 0)
+          {
+            for (const auto *snapshot : _retired) delete snapshot;
+            _retired.clear();
+          }
+      }
+    _mutex.unlock();
+  }
+
+private:
+  static const Snapshot &emptySnapshot(void)
+  {
+    static const Snapshot empty;
+    return empty;
+  }
+
+  std::atomic<const Snapshot *> _published;
+  mutable std::atomic<size_t> _numReaders;
+
+  std::recursive_mutex _mutex;
+  Snapshot *_pending;
+  size_t _depth;
+  bool _modified;
+  std::vector<const Snapshot *> _retired;
+};
@@ -0,0 +1,247 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/StreamAdapter.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdlib>
+#include <cmath>
+
+//the largest magnitude of an integer format, 1.0 for floating point formats
+static double formatFullScale(const std::string &format)
+{
+  const size_t pos = (not format.empty() and format[0] == 'C')?1:0;
+  if (format.size() <= pos or (format[pos] != 'S' and format[pos] != 'U')) return 1.0;
+  const int bits = std::atoi(format.c_str()+pos+1);
+  return (bits < 2)?1.0:std::ldexp(1.0, bits-1);
+}
+
+SoapySDR::StreamAdapter::StreamAdapter(
+  Device *device,
+  const int direction,
+  const std::string &format,
+  const std::vector<size_t> &channels,
+  const Kwargs &args):
+  _device(device),
+  _stream(nullptr),
+  _direction(direction),
+  _format(format),
+  _passthrough(true),
+  _direct(false),
+  _channel(channels.empty()?0:channels.front()),
+  _numChans(std::max<size_t>(1, channels.size())),
+  _mtu(0),
+  _rate(0.0),
+  _held(false),
+  _heldHandle(0),
+  _heldOffset(0),
+  _heldElems(0),
+  _heldFlags(0),
+  _heldTimeNs(0)
+{
+  double fullScale(0.0);
+  _nativeFormat = _device->getNativeStreamFormat(direction, _channel, fullScale);
+  if (fullScale <= 0.0) fullScale = formatFullScale(_nativeFormat);
+
+  if (_nativeFormat != format)
+    {
+      //map the device full scale onto the full scale of the requested format
+      const double nativeScale = formatFullScale(_nativeFormat);
+      const bool rx = direction == SOAPY_SDR_RX;
+      try
+        {
+          _plan = rx?
+            ConverterPlan(_nativeFormat, format, nativeScale/fullScale):
+            ConverterPlan(format, _nativeFormat, fullScale/nativeScale);
+          _passthrough = false;
+        }
+      catch (const std::runtime_error &)
+        {
+          const auto formats = _device->getStreamFormats(direction, _channel);
+          if (std::find(formats.begin(), formats.end(), format) == formats.end())
+            {
+              throw std::runtime_error("StreamAdapter() no conversion; "
+                                       "format="+format+", nativeFormat="+_nativeFormat);
+            }
+          //the driver converts this format itself
+          _nativeFormat = format;
+        }
+    }
+
+  _stream = _device->setupStream(direction, _nativeFormat, channels, args);
+  if (_stream == nullptr)
+    {
+      throw std::runtime_error("StreamAdapter() setupStream failed; nativeFormat="+_nativeFormat);
+    }
+
+  //the destructor does not run when the constructor throws
+  try
+    {
+      _mtu = _device->getStreamMTU(_stream);
+      if (_passthrough) return;
+
+      _direct = _device->getNumDirectAccessBuffers(_stream) != 0;
+      _inPtrs.resize(_numChans);
+      _outPtrs.resize(_numChans);
+      _heldBuffs.resize(_numChans);
+      if (_direct) return;
+
+      const size_t nativeSize = formatToSize(_nativeFormat);
+      BufferArgs bufferArgs;
+      bufferArgs.numaNode = getNumaNode(_device, direction, _channel);
+      _scratch.reserve(_numChans);
+      for (size_t i = 0; i < _numChans; i++)
+        {
+          _scratch.emplace_back(_mtu*nativeSize, bufferArgs);
+          _scratchPtrs.push_back(_scratch.back().data());
+        }
+    }
+  catch (...)
+    {
+      _device->closeStream(_stream);
+      throw;
+    }
+}
+
+SoapySDR::StreamAdapter::~StreamAdapter(void)
+{
+  this->releaseHeld();
+  _device->closeStream(_stream);
+}
+
+SoapySDR::Device *SoapySDR::StreamAdapter::getDevice(void) const
+{
+  return _device;
+}
+
+SoapySDR::Stream *SoapySDR::StreamAdapter::getNativeStream(void) const
+{
+  return _stream;
+}
+
+const std::string &SoapySDR::StreamAdapter::getFormat(void) const
+{
+  return _format;
+}
+
+const std::string &SoapySDR::StreamAdapter::getNativeFormat(void) const
+{
+  return _nativeFormat;
+}
+
+bool SoapySDR::StreamAdapter::isPassthrough(void) const
+{
+  return _passthrough;
+}
+
+bool SoapySDR::StreamAdapter::usesDirectAccess(void) const
+{
+  return _direct;
+}
+
+double SoapySDR::StreamAdapter::getScaler(void) const
+{
+  return _passthrough?1.0:_plan.getScaler();
+}
+
+size_t SoapySDR::StreamAdapter::getMTU(void) const
+{
+  return _mtu;
+}
+
+int SoapySDR::StreamAdapter::activate(const int flags, const long long timeNs, const size_t numElems)
+{
+  //the rate gives the timestamps of fragments of a direct access buffer
+  if (_direct and _direction == SOAPY_SDR_RX) _rate = _device->getSampleRate(_direction, _channel);
+  return _device->activateStream(_stream, flags, timeNs, numElems);
+}
+
+int SoapySDR::StreamAdapter::deactivate(const int flags, const long long timeNs)
+{
+  this->releaseHeld();
+  return _device->deactivateStream(_stream, flags, timeNs);
+}
+
+int SoapySDR::StreamAdapter::read(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+{
+  if (_passthrough) return _device->readStream(_stream, buffs, numElems, flags, timeNs, timeoutUs);
+  if (_direct) return this->readDirect(buffs, numElems, flags, timeNs, timeoutUs);
+
+  const int ret = _device->readStream(_stream, _scratchPtrs.data(), std::min(numElems, _mtu), flags, timeNs, timeoutUs);
+  if (ret <= 0) return ret;
+  _plan.executeBatch(_scratchPtrs.data(), buffs, _numChans, size_t(ret));
+  return ret;
+}
+
+int SoapySDR::StreamAdapter::write(const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long timeoutUs)
+{
+  if (_passthrough) return _device->writeStream(_stream, buffs, numElems, flags, timeNs, timeoutUs);
+  if (_direct) return this->writeDirect(buffs, numElems, flags, timeNs, timeoutUs);
+
+  const size_t n = std::min(numElems, _mtu);
+  _plan.executeBatch(buffs, _scratchPtrs.data(), _numChans, n);
+  int writeFlags = flags;
+  if (n < numElems) writeFlags &= ~SOAPY_SDR_END_BURST;
+  const int ret = _device->writeStream(_stream, _scratchPtrs.data(), n, writeFlags, timeNs, timeoutUs);
+  flags = writeFlags;
+  return ret;
+}
+
+int SoapySDR::StreamAdapter::readStatus(size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs)
+{
+  return _device->readStreamStatus(_stream, chanMask, flags, timeNs, timeoutUs);
+}
+
+int SoapySDR::StreamAdapter::readDirect(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+{
+  if (not _held)
+    {
+      const int ret = _device->acquireReadBuffer(_stream, _heldHandle, _heldBuffs.data(), _heldFlags, _heldTimeNs, timeoutUs);
+      if (ret < 0) return ret;
+      _held = true;
+      _heldOffset = 0;
+      _heldElems = size_t(ret);
+    }
+
+  const size_t nativeSize = _plan.getSourceSize();
+  const size_t n = std::min(numElems, _heldElems-_heldOffset);
+  for (size_t i = 0; i < _numChans; i++)
+    {
+      _inPtrs[i] = (const char *)_heldBuffs[i] + _heldOffset*nativeSize;
+    }
+  _plan.executeBatch(_inPtrs.data(), buffs, _numChans, n);
+
+  flags = _heldFlags;
+  timeNs = _heldTimeNs;
+  if (_heldOffset != 0 and _rate > 0.0) timeNs += ticksToTimeNs((long long)_heldOffset, _rate);
+  _heldOffset += n;
+  if (_heldOffset < _heldElems)
+    {
+      flags = (flags & ~SOAPY_SDR_END_BURST) | SOAPY_SDR_MORE_FRAGMENTS;
+    }
+  else this->releaseHeld();
+  return int(n);
+}
+
+int SoapySDR::StreamAdapter::writeDirect(const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long timeoutUs)
+{
+  size_t handle(0);
+  const int ret = _device->acquireWriteBuffer(_stream, handle, _outPtrs.data(), timeoutUs);
+  if (ret < 0) return ret;
+
+  const size_t n = std::min(numElems, size_t(ret));
+  _plan.executeBatch(buffs, _outPtrs.data(), _numChans, n);
+  int writeFlags = flags;
+  if (n < numElems) writeFlags &= ~SOAPY_SDR_END_BURST;
+  _device->releaseWriteBuffer(_stream, handle, n, writeFlags, timeNs);
+  flags = writeFlags;
+  return int(n);
+}
+
+void SoapySDR::StreamAdapter::releaseHeld(void)
+{
+  if (not _held) return;
+  _device->releaseReadBuffer(_stream, _heldHandle);
+  _held = false;
+}
@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <SoapySDR/Buffer.hpp>
+#include <condition_variable>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/***********************************************************************
+ * A lock-free single producer, single consumer ring of stream chunks.
+ *
+ * Each slot holds one buffer per channel and the result of the
+ * readStream() or writeStream() call that the chunk belongs to.
+ * Filling and draining the ring never takes a lock; the mutex is only
+ * used to sleep in waitFront() and waitBack(), and push() and pop()
+ * only touch it when the other side is asleep.
+ **********************************************************************/
+class StreamRing
+{
+public:
+  struct Slot
+  {
+    std::vector<void *> buffs;
+    int ret; //number of elements or error code
+    int flags;
+    long long timeNs;
+  };
+
+  //the cache line size that separates the indexes
+  static const size_t ALIGNMENT = SOAPY_SDR_BUFFER_ALIGNMENT;
+
+  //slot buffers keep the alignment of the buffer args
+  StreamRing(const size_t depth, const size_t numChans, const size_t chunkBytes, const SoapySDR::BufferArgs &args):
+    _slots(depth),
+    _head(0),
+    _tail(0),
+    _numWaiters(0)
+  {
+    const size_t stride = (chunkBytes + args.alignment - 1) & ~(args.alignment - 1);
+    _memory = SoapySDR::Buffer(depth*numChans*stride, args);
+    char *p = (char *)_memory.data();
+    for (auto &slot : _slots)
+      {
+        for (size_t i = 0; i < numChans; i++, p += stride) slot.buffs.push_back(p);
+        slot.ret = 0;
+        slot.flags = 0;
+        slot.timeNs = 0;
+      }
+  }
+
+  size_t depth(void) const
+  {
+    return _slots.size();
+  }
+
+  //the number of filled slots
+  size_t size(void) const
+  {
+    const size_t tail = _tail.load();
+    return _head.load() - tail;
+  }
+
+  //producer: the next free slot or nullptr when the ring is full
+  Slot *back(void)
+  {
+    const size_t head = _head.load(std::memory_order_relaxed);
+    if (head - _tail.load() == _slots.size()) return nullptr;
+    return &_slots[head % _slots.size()];
+  }
+
+  //producer: publish the slot returned by back()
+  void push(void)
+  {
+    _head.store(_head.load(std::memory_order_relaxed) + 1);
+    this->notify();
+  }
+
+  //consumer: the oldest filled slot or nullptr when the ring is empty
+  Slot *front(void)
+  {
+    const size_t tail = _tail.load(std::memory_order_relaxed);
+    if (_head.load() == tail) return nullptr;
+    return &_slots[tail % _slots.size()];
+  }
+
+  //consumer: the filled slot at the index from the oldest, index < size()
+  Slot *at(const size_t index)
+  {
+    return &_slots[(_tail.load(std::memory_order_relaxed) + index) % _slots.size()];
+  }
+
+  //consumer: free the slot returned by front()
+  void pop(void)
+  {
+    _tail.store(_tail.load(std::memory_order_relaxed) + 1);
+    this->notify();
+  }
+
+  //free every filled slot, only while the other side is stopped
+  void clear(void)
+  {
+    _tail.store(_head.load());
+    this->notify();
+  }
+
+  //consumer: wait for a filled slot, nullptr on timeout
+  Slot *waitFront(const long timeoutUs)
+  {
+    Slot *slot(nullptr);
+    this->waitUntil([&]{return (slot = this->front()) != nullptr;}, timeoutUs);
+    return slot;
+  }
+
+  //producer: wait for a free slot, nullptr on timeout
+  Slot *waitBack(const long timeoutUs)
+  {
+    Slot *slot(nullptr);
+    this->waitUntil([&]{return (slot = this->back()) != nullptr;}, timeoutUs);
+    return slot;
+  }
+
+  /*!
+   * Wait for a condition on the ring, which is checked again every
+   * time that either side pushes or pops a slot.
+   * \return the last result of the condition, false on timeout
+   */
+  template <typename Predicate>
+  bool waitUntil(Predicate predicate, const long timeoutUs)
+  {
+    bool ready = predicate();
+    if (ready or timeoutUs <= 0) return ready;
+
+    const auto exitTime = std::chrono::steady_clock::now() + std::chrono::microseconds(timeoutUs);
+    _numWaiters++;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      ready = _cond.wait_until(lock, exitTime, predicate);
+    }
+    _numWaiters--;
+    return ready;
+  }
+
+  //wake the waiters to check their condition again after a change outside the ring
+  void notify(void)
+  {
+    //sequentially consistent with the index stores, so a waiter that
+    //registered before its last check of the indexes is always woken
+    if (_numWaiters.load() == 0) return;
+    std::lock_guard<std::mutex> lock(_mutex);
+    _cond.notify_all();
+  }
+
+private:
+  SoapySDR::Buffer _memory;
+  std::vector<Slot> _slots;
+  //the indexes live on separate cache lines, padded rather than aligned
+  //since over-aligned types are not supported by operator new before C++17
+  char _pad0[ALIGNMENT];
+  std::atomic<size_t> _head; //written by the producer
+  char _pad1[ALIGNMENT];
+  std::atomic<size_t> _tail; //written by the consumer
+  char _pad2[ALIGNMENT];
+  std::atomic<size_t> _numWaiters;
+  char _pad3[ALIGNMENT];
+  std::mutex _mutex;
+  std::condition_variable _cond;
+};
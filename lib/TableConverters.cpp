@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// Lookup table converters from the complex 8-bit formats (CU8 and CS8) to CF32.
+// With only 65536 codes for a pair of bytes, the scaled output for every I/Q pair fits
+// one table, so a conversion is a single lookup per complex sample with the offset
+// and the scaler folded in. Each thread keeps its own table and rebuilds it when
+// the scaler changes. The entries use the generic expression, so the output is bit-exact.
+//
+// The tables need no CPU features, so they serve builds without the x86 kernels and
+// x86 hosts where SOAPY_SDR_CPU_FEATURES masks the kernels off. The SSE2 and AVX2
+// converters for these pairs are faster and outrank them when available, and so is
+// the compiler-vectorized generic loop for the real formats, which is why U8 and S8
+// have no table converter.
+
+#include "SampleConversion.hpp"
+#include "VectorizedHelpers.hpp"
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <cstring> //memcpy
+#include <vector>
+
+typedef SoapySDR::ConverterRegistry CR;
+
+// ********************************
+// Lookup tables
+
+/*!
+ * Table of the scaled float pair for every pair of input bytes,
+ * so that one 16-bit load and one 8-byte copy convert a complex sample.
+ * The 512 KiB table is allocated on first use, aligned to a cache line.
+ */
+template <typename From>
+class PairTable
+{
+public:
+  PairTable(void):
+    _entries(nullptr),
+    _scaler(0.0)
+  {
+    return;
+  }
+
+  //the entries for the given scaler, indexed by a native 16-bit load of two input bytes
+  const float *update(const double scaler)
+  {
+    if (_entries != nullptr and _scaler == scaler) return _entries;
+    if (_entries == nullptr)
+      {
+        _storage.resize(65536*2 + 64/sizeof(float));
+        const size_t misalign = size_t(_storage.data()) % 64;
+        _entries = _storage.data() + (misalign == 0?0:(64-misalign)/sizeof(float));
+      }
+
+    float single[256];
+    for (size_t code = 0; code < 256; code++)
+      {
+        single[code] = scaleSample<From, float>(From(code), scaler);
+      }
+    for (size_t code = 0; code < 65536; code++)
+      {
+        uint8_t bytes[2];
+        const uint16_t code16(code);
+        std::memcpy(bytes, &code16, sizeof(bytes));
+        _entries[code*2+0] = single[bytes[0]];
+        _entries[code*2+1] = single[bytes[1]];
+      }
+    _scaler = scaler;
+    return _entries;
+  }
+
+private:
+  std::vector<float> _storage;
+  float *_entries;
+  double _scaler;
+};
+
+template <typename From>
+static const float *pairTable(const double scaler)
+{
+  static thread_local PairTable<From> table;
+  return table.update(scaler);
+}
+
+// ********************************
+// Converters
+
+template <typename From>
+static void tableByteToCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  const float *table = pairTable<From>(scaler);
+
+  for (size_t i = 0; i < numElems*2; i += 2)
+    {
+      uint16_t code;
+      std::memcpy(&code, src+i, sizeof(code));
+      std::memcpy(dst+i, table+size_t(code)*2, 2*sizeof(float));
+    }
+}
+
+// ********************************
+// Registration
+
+/*!
+ * Register the lookup table converters at VECTORIZED priority without CPU features,
+ * so that the feature ranking keeps the x86 kernels for the same pairs when the host has them.
+ * Called from lateLoadDefaultConverters().
+ */
+void lateLoadTableConverters(void)
+{
+  CR(SOAPY_SDR_CU8, SOAPY_SDR_CF32, CR::VECTORIZED, &tableByteToCF32<uint8_t>, 0);
+  CR(SOAPY_SDR_CS8, SOAPY_SDR_CF32, CR::VECTORIZED, &tableByteToCF32<int8_t>, 0);
+}
@@ -0,0 +1,469 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// Vectorized implementations of the most commonly used complex converters.
+// Every kernel is registered with the CPU features it requires.
+// Each kernel is bit-exact with its generic counterpart in DefaultConverters.cpp:
+// the scaler is folded into a single float multiplier, which only yields the same
+// rounding as the generic double-precision path when the scaler is representable
+// as a float. Other scalers and the remaining tail elements use the primitives.
+
+#include <SoapySDR/ConverterPrimitives.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include "VectorizedHelpers.hpp"
+
+// ********************************
+// Scalar fallbacks (same expressions as the generic converters)
+
+static void scalarS16toF32(const int16_t *src, float *dst, const size_t n, const double scaler)
+{
+  for (size_t i = 0; i < n; i++) dst[i] = SoapySDR::S16toF32(src[i]) * scaler;
+}
+
+static void scalarU16toF32(const uint16_t *src, float *dst, const size_t n, const double scaler)
+{
+  for (size_t i = 0; i < n; i++) dst[i] = SoapySDR::U16toF32(src[i]) * scaler;
+}
+
+static void scalarS8toF32(const int8_t *src, float *dst, const size_t n, const double scaler)
+{
+  for (size_t i = 0; i < n; i++) dst[i] = SoapySDR::S8toF32(src[i]) * scaler;
+}
+
+static void scalarU8toF32(const uint8_t *src, float *dst, const size_t n, const double scaler)
+{
+  for (size_t i = 0; i < n; i++) dst[i] = SoapySDR::U8toF32(src[i]) * scaler;
+}
+
+static void scalarF32toS16(const float *src, int16_t *dst, const size_t n, const double scaler)
+{
+  for (size_t i = 0; i < n; i++) dst[i] = SoapySDR::F32toS16(src[i] * scaler);
+}
+
+static void scalarF32toU16(const float *src, uint16_t *dst, const size_t n, const double scaler)
+{
+  for (size_t i = 0; i < n; i++) dst[i] = SoapySDR::F32toU16(src[i] * scaler);
+}
+
+static void scalarF32toS8(const float *src, int8_t *dst, const size_t n, const double scaler)
+{
+  for (size_t i = 0; i < n; i++) dst[i] = SoapySDR::F32toS8(src[i] * scaler);
+}
+
+static void scalarF32toU8(const float *src, uint8_t *dst, const size_t n, const double scaler)
+{
+  for (size_t i = 0; i < n; i++) dst[i] = SoapySDR::F32toU8(src[i] * scaler);
+}
+
+// ********************************
+// SSE2 kernels
+
+#ifdef SOAPY_SDR_CONVERTERS_X86
+
+SOAPY_SDR_TARGET("sse2")
+static void sse2CS16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, 1.0/SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      for (; i+8 <= n; i += 8)
+        {
+          sse2S16toF32x8(_mm_loadu_si128((const __m128i*)(src+i)), factor, dst+i);
+        }
+    }
+  scalarS16toF32(src+i, dst+i, n-i, scaler);
+}
+
+SOAPY_SDR_TARGET("sse2")
+static void sse2CU16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const uint16_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, 1.0/SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      const __m128i offset = _mm_set1_epi16(short(SoapySDR::U16_ZERO_OFFSET));
+      for (; i+8 <= n; i += 8)
+        {
+          const __m128i in = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(src+i)), offset);
+          sse2S16toF32x8(in, factor, dst+i);
+        }
+    }
+  scalarU16toF32(src+i, dst+i, n-i, scaler);
+}
+
+SOAPY_SDR_TARGET("sse2")
+static void sse2CS8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const int8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, 1.0/SoapySDR::S8_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      for (; i+16 <= n; i += 16)
+        {
+          const __m128i in = _mm_loadu_si128((const __m128i*)(src+i));
+          sse2S16toF32x8(_mm_srai_epi16(_mm_unpacklo_epi8(in, in), 8), factor, dst+i+0);
+          sse2S16toF32x8(_mm_srai_epi16(_mm_unpackhi_epi8(in, in), 8), factor, dst+i+8);
+        }
+    }
+  scalarS8toF32(src+i, dst+i, n-i, scaler);
+}
+
+SOAPY_SDR_TARGET("sse2")
+static void sse2CU8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, 1.0/SoapySDR::S8_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      const __m128i offset = _mm_set1_epi8(char(SoapySDR::U8_ZERO_OFFSET));
+      for (; i+16 <= n; i += 16)
+        {
+          const __m128i in = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(src+i)), offset);
+          sse2S16toF32x8(_mm_srai_epi16(_mm_unpacklo_epi8(in, in), 8), factor, dst+i+0);
+          sse2S16toF32x8(_mm_srai_epi16(_mm_unpackhi_epi8(in, in), 8), factor, dst+i+8);
+        }
+    }
+  scalarU8toF32(src+i, dst+i, n-i, scaler);
+}
+
+SOAPY_SDR_TARGET("sse2")
+static void sse2CF32toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      for (; i+8 <= n; i += 8)
+        {
+          _mm_storeu_si128((__m128i*)(dst+i), sse2F32toS16x8(src+i, factor));
+        }
+    }
+  scalarF32toS16(src+i, dst+i, n-i, scaler);
+}
+
+SOAPY_SDR_TARGET("sse2")
+static void sse2CF32toCU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      const __m128i offset = _mm_set1_epi16(short(SoapySDR::U16_ZERO_OFFSET));
+      for (; i+8 <= n; i += 8)
+        {
+          _mm_storeu_si128((__m128i*)(dst+i), _mm_xor_si128(sse2F32toS16x8(src+i, factor), offset));
+        }
+    }
+  scalarF32toU16(src+i, dst+i, n-i, scaler);
+}
+
+SOAPY_SDR_TARGET("sse2")
+static void sse2CF32toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S8_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      for (; i+16 <= n; i += 16)
+        {
+          _mm_storeu_si128((__m128i*)(dst+i), sse2F32toS8x16(src+i, factor));
+        }
+    }
+  scalarF32toS8(src+i, dst+i, n-i, scaler);
+}
+
+SOAPY_SDR_TARGET("sse2")
+static void sse2CF32toCU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S8_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      const __m128i offset = _mm_set1_epi8(char(SoapySDR::U8_ZERO_OFFSET));
+      for (; i+16 <= n; i += 16)
+        {
+          _mm_storeu_si128((__m128i*)(dst+i), _mm_xor_si128(sse2F32toS8x16(src+i, factor), offset));
+        }
+    }
+  scalarF32toU8(src+i, dst+i, n-i, scaler);
+}
+
+#endif //SOAPY_SDR_CONVERTERS_X86
+
+// ********************************
+// SSE4.1 kernels (sign extension without the unpack/shift pairs)
+
+#ifdef SOAPY_SDR_CONVERTERS_X86
+
+SOAPY_SDR_TARGET("sse4.1")
+static void sse41CS16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, 1.0/SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      for (; i+4 <= n; i += 4)
+        {
+          const __m128i in = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*)(src+i)));
+          _mm_storeu_ps(dst+i, _mm_mul_ps(_mm_cvtepi32_ps(in), factor));
+        }
+    }
+  scalarS16toF32(src+i, dst+i, n-i, scaler);
+}
+
+SOAPY_SDR_TARGET("sse4.1")
+static void sse41CS8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const int8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, 1.0/SoapySDR::S8_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      for (; i+4 <= n; i += 4)
+        {
+          const __m128i in = _mm_cvtepi8_epi32(_mm_cvtsi32_si128(*(const int32_t*)(src+i)));
+          _mm_storeu_ps(dst+i, _mm_mul_ps(_mm_cvtepi32_ps(in), factor));
+        }
+    }
+  scalarS8toF32(src+i, dst+i, n-i, scaler);
+}
+
+SOAPY_SDR_TARGET("sse4.1")
+static void sse41CU8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, 1.0/SoapySDR::S8_FULL_SCALE, f))
+    {
+      const __m128 factor = _mm_set1_ps(f);
+      const __m128i offset = _mm_set1_epi32(SoapySDR::U8_ZERO_OFFSET);
+      for (; i+4 <= n; i += 4)
+        {
+          const __m128i in = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(const int32_t*)(src+i)));
+          _mm_storeu_ps(dst+i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(in, offset)), factor));
+        }
+    }
+  scalarU8toF32(src+i, dst+i, n-i, scaler);
+}
+
+#endif //SOAPY_SDR_CONVERTERS_X86
+
+// ********************************
+// AVX2 kernels
+
+#ifdef SOAPY_SDR_CONVERTERS_X86
+
+SOAPY_SDR_TARGET("avx2")
+static void avx2CS16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, 1.0/SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m256 factor = _mm256_set1_ps(f);
+      for (; i+8 <= n; i += 8)
+        {
+          const __m256i in = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(src+i)));
+          _mm256_storeu_ps(dst+i, _mm256_mul_ps(_mm256_cvtepi32_ps(in), factor));
+        }
+    }
+  scalarS16toF32(src+i, dst+i, n-i, scaler);
+}
+
+SOAPY_SDR_TARGET("avx2")
+static void avx2CU16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const uint16_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, 1.0/SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m256 factor = _mm256_set1_ps(f);
+      const __m256i offset = _mm256_set1_epi32(SoapySDR::U16_ZERO_OFFSET);
+      for (; i+8 <= n; i += 8)
+        {
+          const __m256i in = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(src+i)));
+          _mm256_storeu_ps(dst+i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(in, offset)), factor));
+        }
+    }
+  scalarU16toF32(src+i, dst+i, n-i, scaler);
+}
+
+SOAPY_SDR_TARGET("avx2")
+static void avx2CS8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const int8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, 1.0/SoapySDR::S8_FULL_SCALE, f))
+    {
+      const __m256 factor = _mm256_set1_ps(f);
+      for (; i+8 <= n; i += 8)
+        {
+          const __m256i in = _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)(src+i)));
+          _mm256_storeu_ps(dst+i, _mm256_mul_ps(_mm256_cvtepi32_ps(in), factor));
+        }
+    }
+  scalarS8toF32(src+i, dst+i, n-i, scaler);
+}
+
+SOAPY_SDR_TARGET("avx2")
+static void avx2CU8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, 1.0/SoapySDR::S8_FULL_SCALE, f))
+    {
+      const __m256 factor = _mm256_set1_ps(f);
+      const __m256i offset = _mm256_set1_epi32(SoapySDR::U8_ZERO_OFFSET);
+      for (; i+8 <= n; i += 8)
+        {
+          const __m256i in = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src+i)));
+          _mm256_storeu_ps(dst+i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(in, offset)), factor));
+        }
+    }
+  scalarU8toF32(src+i, dst+i, n-i, scaler);
+}
+
+SOAPY_SDR_TARGET("avx2")
+static void avx2CF32toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m256 factor = _mm256_set1_ps(f);
+      for (; i+16 <= n; i += 16)
+        {
+          _mm256_storeu_si256((__m256i*)(dst+i), avx2F32toS16x16(src+i, factor));
+        }
+    }
+  scalarF32toS16(src+i, dst+i, n-i, scaler);
+}
+
+SOAPY_SDR_TARGET("avx2")
+static void avx2CF32toCU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S16_FULL_SCALE, f))
+    {
+      const __m256 factor = _mm256_set1_ps(f);
+      const __m256i offset = _mm256_set1_epi16(short(SoapySDR::U16_ZERO_OFFSET));
+      for (; i+16 <= n; i += 16)
+        {
+          _mm256_storeu_si256((__m256i*)(dst+i), _mm256_xor_si256(avx2F32toS16x16(src+i, factor), offset));
+        }
+    }
+  scalarF32toU16(src+i, dst+i, n-i, scaler);
+}
+
+SOAPY_SDR_TARGET("avx2")
+static void avx2CF32toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S8_FULL_SCALE, f))
+    {
+      const __m256 factor = _mm256_set1_ps(f);
+      for (; i+32 <= n; i += 32)
+        {
+          _mm256_storeu_si256((__m256i*)(dst+i), avx2F32toS8x32(src+i, factor));
+        }
+    }
+  scalarF32toS8(src+i, dst+i, n-i, scaler);
+}
+
+SOAPY_SDR_TARGET("avx2")
+static void avx2CF32toCU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t n = numElems*2;
+  auto *src = (const float*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  float f; size_t i = 0;
+  if (foldScaler(scaler, SoapySDR::S8_FULL_SCALE, f))
+    {
+      const __m256 factor = _mm256_set1_ps(f);
+      const __m256i offset = _mm256_set1_epi8(char(SoapySDR::U8_ZERO_OFFSET));
+      for (; i+32 <= n; i += 32)
+        {
+          _mm256_storeu_si256((__m256i*)(dst+i), _mm256_xor_si256(avx2F32toS8x32(src+i, factor), offset));
+        }
+    }
+  scalarF32toU8(src+i, dst+i, n-i, scaler);
+}
+
+#endif //SOAPY_SDR_CONVERTERS_X86
+
+/*!
+ * Register the kernels for every instruction set, the registry keeps the
+ * most capable one that the host supports. Called from lateLoadDefaultConverters().
+ */
+void lateLoadVectorizedConverters(void)
+{
+#ifdef SOAPY_SDR_CONVERTERS_X86
+  static SoapySDR::ConverterRegistry registerSSE2CS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS16toCF32, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerSSE2CU16toCF32(SOAPY_SDR_CU16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CU16toCF32, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerSSE2CS8toCF32(SOAPY_SDR_CS8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS8toCF32, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerSSE2CU8toCF32(SOAPY_SDR_CU8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CU8toCF32, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerSSE2CF32toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF32toCS16, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerSSE2CF32toCU16(SOAPY_SDR_CF32, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF32toCU16, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerSSE2CF32toCS8(SOAPY_SDR_CF32, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF32toCS8, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerSSE2CF32toCU8(SOAPY_SDR_CF32, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF32toCU8, SoapySDR::ConverterRegistry::CPU_SSE2);
+  static SoapySDR::ConverterRegistry registerSSE41CS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CS16toCF32, SoapySDR::ConverterRegistry::CPU_SSE41);
+  static SoapySDR::ConverterRegistry registerSSE41CS8toCF32(SOAPY_SDR_CS8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CS8toCF32, SoapySDR::ConverterRegistry::CPU_SSE41);
+  static SoapySDR::ConverterRegistry registerSSE41CU8toCF32(SOAPY_SDR_CU8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CU8toCF32, SoapySDR::ConverterRegistry::CPU_SSE41);
+  static SoapySDR::ConverterRegistry registerAVX2CS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CS16toCF32, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerAVX2CU16toCF32(SOAPY_SDR_CU16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CU16toCF32, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerAVX2CS8toCF32(SOAPY_SDR_CS8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CS8toCF32, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerAVX2CU8toCF32(SOAPY_SDR_CU8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CU8toCF32, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerAVX2CF32toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF32toCS16, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerAVX2CF32toCU16(SOAPY_SDR_CF32, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF32toCU16, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerAVX2CF32toCS8(SOAPY_SDR_CF32, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF32toCS8, SoapySDR::ConverterRegistry::CPU_AVX2);
+  static SoapySDR::ConverterRegistry registerAVX2CF32toCU8(SOAPY_SDR_CF32, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF32toCU8, SoapySDR::ConverterRegistry::CPU_AVX2);
+#endif //SOAPY_SDR_CONVERTERS_X86
+}
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <SoapySDR/ConverterPrimitives.hpp>
+#include <cstddef>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define SOAPY_SDR_CONVERTERS_X86
+#include <immintrin.h>
+#endif
+
+//Kernels are compiled for their instruction set regardless of the build flags,
+//the registry only selects them when the host CPU supports the instructions.
+#ifdef __GNUC__
+#define SOAPY_SDR_TARGET(isa) __attribute__((target(isa)))
+#else
+#define SOAPY_SDR_TARGET(isa)
+#endif
+
+/*!
+ * Fold the scaler and the format full scale into one float multiplier.
+ * \return false when the folded value would round differently than the generic path
+ */
+static inline bool foldScaler(const double scaler, const double fullScale, float &factor)
+{
+  factor = float(scaler * fullScale);
+  return double(factor) / fullScale == scaler;
+}
+
+#ifdef SOAPY_SDR_CONVERTERS_X86
+
+/***********************************************************************
+ * SSE2 building blocks
+ **********************************************************************/
+
+// 8 x int16 -> 2 x (4 x float)
+SOAPY_SDR_TARGET("sse2")
+static inline void sse2S16toF32x8(const __m128i in, const __m128 factor, float *out)
+{
+  const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16);
+  const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16);
+  _mm_storeu_ps(out+0, _mm_mul_ps(_mm_cvtepi32_ps(lo), factor));
+  _mm_storeu_ps(out+4, _mm_mul_ps(_mm_cvtepi32_ps(hi), factor));
+}
+
+// 2 x (4 x float) -> 8 x int16, wrapping like the scalar cast
+SOAPY_SDR_TARGET("sse2")
+static inline __m128i sse2F32toS16x8(const float *in, const __m128 factor)
+{
+  const __m128i lo = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(in+0), factor));
+  const __m128i hi = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(in+4), factor));
+  return _mm_packs_epi32(
+    _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16),
+    _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16));
+}
+
+// 4 x (4 x float) -> 16 x int8, wrapping like the scalar cast
+SOAPY_SDR_TARGET("sse2")
+static inline __m128i sse2F32toS8x16(const float *in, const __m128 factor)
+{
+  __m128i v[4];
+  for (size_t j = 0; j < 4; j++)
+    {
+      const __m128i i32 = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(in+4*j), factor));
+      v[j] = _mm_srai_epi32(_mm_slli_epi32(i32, 24), 24);
+    }
+  return _mm_packs_epi16(_mm_packs_epi32(v[0], v[1]), _mm_packs_epi32(v[2], v[3]));
+}
+
+// 2 x (4 x float) -> 8 x int16, rounding and saturating like F32toS16Sat()
+// positive overflow is clamped before the conversion, which returns INT32_MIN for out of range values,
+// then the signed pack saturates both ends
+SOAPY_SDR_TARGET("sse2")
+static inline __m128i sse2F32toS16Satx8(const float *in, const __m128 factor)
+{
+  const __m128 limit = _mm_set1_ps(32767.0f);
+  const __m128i lo = _mm_cvtps_epi32(_mm_min_ps(_mm_mul_ps(_mm_loadu_ps(in+0), factor), limit));
+  const __m128i hi = _mm_cvtps_epi32(_mm_min_ps(_mm_mul_ps(_mm_loadu_ps(in+4), factor), limit));
+  return _mm_packs_epi32(lo, hi);
+}
+
+// 4 x (4 x float) -> 16 x int8, rounding and saturating like F32toS8Sat()
+SOAPY_SDR_TARGET("sse2")
+static inline __m128i sse2F32toS8Satx16(const float *in, const __m128 factor)
+{
+  const __m128 limit = _mm_set1_ps(127.0f);
+  __m128i v[4];
+  for (size_t j = 0; j < 4; j++)
+    {
+      v[j] = _mm_cvtps_epi32(_mm_min_ps(_mm_mul_ps(_mm_loadu_ps(in+4*j), factor), limit));
+    }
+  return _mm_packs_epi16(_mm_packs_epi32(v[0], v[1]), _mm_packs_epi32(v[2], v[3]));
+}
+
+/***********************************************************************
+ * AVX2 building blocks
+ **********************************************************************/
+
+// 2 x (8 x float) -> 16 x int16 in order, wrapping like the scalar cast
+SOAPY_SDR_TARGET("avx2")
+static inline __m256i avx2F32toS16x16(const float *in, const __m256 factor)
+{
+  const __m256i lo = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_loadu_ps(in+0), factor));
+  const __m256i hi = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_loadu_ps(in+8), factor));
+  const __m256i packed = _mm256_packs_epi32(
+    _mm256_srai_epi32(_mm256_slli_epi32(lo, 16), 16),
+    _mm256_srai_epi32(_mm256_slli_epi32(hi, 16), 16));
+  return _mm256_permute4x64_epi64(packed, 0xD8);
+}
+
+// 4 x (8 x float) -> 32 x int8 in order, wrapping like the scalar cast
+SOAPY_SDR_TARGET("avx2")
+static inline __m256i avx2F32toS8x32(const float *in, const __m256 factor)
+{
+  __m256i v[4];
+  for (size_t j = 0; j < 4; j++)
+    {
+      const __m256i i32 = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_loadu_ps(in+8*j), factor));
+      v[j] = _mm256_srai_epi32(_mm256_slli_epi32(i32, 24), 24);
+    }
+  const __m256i packed = _mm256_packs_epi16(_mm256_packs_epi32(v[0], v[1]), _mm256_packs_epi32(v[2], v[3]));
+  return _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+}
+
+// 2 x (8 x float) -> 16 x int16 in order, rounding and saturating like F32toS16Sat()
+SOAPY_SDR_TARGET("avx2")
+static inline __m256i avx2F32toS16Satx16(const float *in, const __m256 factor)
+{
+  const __m256 limit = _mm256_set1_ps(32767.0f);
+  const __m256i lo = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_mul_ps(_mm256_loadu_ps(in+0), factor), limit));
+  const __m256i hi = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_mul_ps(_mm256_loadu_ps(in+8), factor), limit));
+  return _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8);
+}
+
+// 4 x (8 x float) -> 32 x int8 in order, rounding and saturating like F32toS8Sat()
+SOAPY_SDR_TARGET("avx2")
+static inline __m256i avx2F32toS8Satx32(const float *in, const __m256 factor)
+{
+  const __m256 limit = _mm256_set1_ps(127.0f);
+  __m256i v[4];
+  for (size_t j = 0; j < 4; j++)
+    {
+      v[j] = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_mul_ps(_mm256_loadu_ps(in+8*j), factor), limit));
+    }
+  const __m256i packed = _mm256_packs_epi16(_mm256_packs_epi32(v[0], v[1]), _mm256_packs_epi32(v[2], v[3]));
+  return _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+}
+
+#endif //SOAPY_SDR_CONVERTERS_X86
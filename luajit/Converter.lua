@@ -0,0 +1,248 @@
+-- SPDX-License-Identifier: BSL-1.0
+
+---
+-- Native format conversion on LuaJIT FFI buffers
+-- @module SoapySDR.Converter
+
+local ffi = require("ffi")
+local lib = require("SoapySDR.Lib")
+local Utility = require("SoapySDR.Utility")
+
+local function checkError(ret)
+    local lastError = ffi.string(lib.SoapySDRDevice_lastError())
+    if #lastError > 0 then
+        error(lastError)
+    end
+
+    return ret
+end
+
+---
+-- Converter priorities, the higher value wins when several are registered.
+--
+-- @field GENERIC usually a hand-written C/C++ implementation
+-- @field VECTORIZED usually uses SIMD instructions
+-- @field CUSTOM custom user re-implementation, max priority
+local Priority =
+{
+    GENERIC    = lib.SOAPY_SDR_CONVERTER_GENERIC,
+    VECTORIZED = lib.SOAPY_SDR_CONVERTER_VECTORIZED,
+    CUSTOM     = lib.SOAPY_SDR_CONVERTER_CUSTOM
+}
+
+---
+-- A conversion between two stream formats, resolved once and executed on
+-- LuaJIT FFI buffers without copies.
+-- @type ConverterPlan
+ConverterPlan = {}
+ConverterPlan_mt =
+{
+    __index = ConverterPlan,
+
+    __tostring = function(self)
+        return string.format("%s -> %s", self:getSourceFormat(), self:getTargetFormat())
+    end
+}
+
+---
+-- Create a plan between two formats.
+--
+-- @tparam SoapySDR.Format sourceFormat the source format
+-- @tparam SoapySDR.Format targetFormat the target format
+-- @tparam[opt=1.0] number scaler the scale factor applied on every execution
+-- @tparam[opt] Priority priority a converter priority, or nil for the selected converter
+function ConverterPlan.new(sourceFormat, targetFormat, scaler, priority)
+    scaler = scaler or 1.0
+
+    local plan = nil
+    if priority then
+        plan = lib.SoapySDRConverterPlan_makeWithPriority(sourceFormat, targetFormat, priority, scaler)
+    else
+        plan = lib.SoapySDRConverterPlan_make(sourceFormat, targetFormat, scaler)
+    end
+
+    if plan == nil then
+        checkError(nil)
+        error(string.format("No conversion from %s to %s", sourceFormat, targetFormat))
+    end
+
+    return setmetatable({__planHandle = ffi.gc(plan, lib.SoapySDRConverterPlan_unmake)}, ConverterPlan_mt)
+end
+
+---
+-- Convert a buffer.
+--
+-- @param src a LuaJIT FFI buffer in the source format
+-- @param dst a LuaJIT FFI buffer in the target format, may equal src when @{ConverterPlan:supportsInPlace}
+-- @tparam uint numElems the number of elements to convert
+--
+-- @usage
+-- local plan = SoapySDR.ConverterPlan.new(SoapySDR.Format.CS16, SoapySDR.Format.CF32, 1.0)
+-- local cs16Buff = ffi.new("int16_t[?]", numElems*2)
+-- local cf32Buff = ffi.new("complex float[?]", numElems)
+-- plan:execute(cs16Buff, cf32Buff, numElems)
+function ConverterPlan:execute(src, dst, numElems)
+    lib.SoapySDRConverterPlan_execute(self.__planHandle, src, dst, numElems)
+end
+
+---
+-- Convert a large buffer on multiple threads.
+--
+-- @param src a LuaJIT FFI buffer in the source format
+-- @param dst a LuaJIT FFI buffer in the target format
+-- @tparam uint numElems the number of elements to convert
+-- @tparam[opt=0] uint numThreads the maximum number of threads including the caller, 0 for one per CPU
+function ConverterPlan:executeParallel(src, dst, numElems, numThreads)
+    checkError(lib.SoapySDRConverterPlan_executeParallel(self.__planHandle, src, dst, numElems, numThreads or 0))
+end
+
+---
+-- Convert several buffers of the same length in one call.
+--
+-- @param srcs a LuaJIT FFI array of pointers to source buffers
+-- @param dsts a LuaJIT FFI array of pointers to target buffers
+-- @tparam uint numBuffs the number of buffers in each array
+-- @tparam uint numElems the number of elements to convert in each buffer
+--
+-- @usage
+-- local srcs = ffi.new("int16_t*[2]", {cs16Buff0, cs16Buff1})
+-- local dsts = ffi.new("complex float*[2]", {cf32Buff0, cf32Buff1})
+-- plan:executeBatch(srcs, dsts, 2, numElems)
+function ConverterPlan:executeBatch(srcs, dsts, numBuffs, numElems)
+    lib.SoapySDRConverterPlan_executeBatch(
+        self.__planHandle,
+        ffi.cast("const void* const*", srcs),
+        ffi.cast("void* const*", dsts),
+        numBuffs,
+        numElems)
+end
+
+---
+-- Convert a buffer and accumulate signal statistics in the same pass.
+--
+-- @param src a LuaJIT FFI buffer in the source format
+-- @param dst a LuaJIT FFI buffer in the target format
+-- @tparam uint numElems the number of elements to convert
+-- @param[opt] stats a SoapySDRConverterStats to accumulate into, or nil for a new one
+-- @return The accumulated SoapySDRConverterStats
+function ConverterPlan:executeWithStats(src, dst, numElems, stats)
+    stats = stats or ffi.new("SoapySDRConverterStats")
+    checkError(lib.SoapySDRConverterPlan_executeWithStats(self.__planHandle, src, dst, numElems, stats))
+    return stats
+end
+
+---
+-- Get the source format.
+-- @treturn SoapySDR.Format The source format
+function ConverterPlan:getSourceFormat()
+    return ffi.string(lib.SoapySDRConverterPlan_getSourceFormat(self.__planHandle))
+end
+
+---
+-- Get the target format.
+-- @treturn SoapySDR.Format The target format
+function ConverterPlan:getTargetFormat()
+    return ffi.string(lib.SoapySDRConverterPlan_getTargetFormat(self.__planHandle))
+end
+
+---
+-- Get the scale factor applied on every execution.
+-- @treturn number The scale factor
+function ConverterPlan:getScaler()
+    return tonumber(lib.SoapySDRConverterPlan_getScaler(self.__planHandle))
+end
+
+---
+-- Get the priority of the resolved converter.
+-- @treturn Priority The converter priority
+function ConverterPlan:getPriority()
+    return tonumber(lib.SoapySDRConverterPlan_getPriority(self.__planHandle))
+end
+
+---
+-- Get the size of a source element in bytes.
+-- @treturn uint The source element size
+function ConverterPlan:getSourceSize()
+    return tonumber(lib.SoapySDRConverterPlan_getSourceSize(self.__planHandle))
+end
+
+---
+-- Get the size of a target element in bytes.
+-- @treturn uint The target element size
+function ConverterPlan:getTargetSize()
+    return tonumber(lib.SoapySDRConverterPlan_getTargetSize(self.__planHandle))
+end
+
+---
+-- Can the plan convert with the target buffer equal to the source buffer?
+-- @treturn bool Whether in-place conversion is supported
+function ConverterPlan:supportsInPlace()
+    return Utility.processOutput(lib.SoapySDRConverterPlan_supportsInPlace(self.__planHandle))
+end
+
+---
+-- A conversion between complex formats fused with a frequency shift.
+-- A mixer holds the oscillator phase, use one mixer per stream.
+-- @type ConverterMixer
+ConverterMixer = {}
+ConverterMixer_mt =
+{
+    __index = ConverterMixer
+}
+
+---
+-- Create a mixer between two complex formats.
+--
+-- @tparam SoapySDR.Format sourceFormat the source format
+-- @tparam SoapySDR.Format targetFormat the target format
+-- @tparam number frequency the shift in cycles per sample, between -0.5 and 0.5
+-- @tparam[opt=1.0] number scaler the scale factor applied when converting from the source format
+function ConverterMixer.new(sourceFormat, targetFormat, frequency, scaler)
+    local mixer = lib.SoapySDRConverterMixer_make(sourceFormat, targetFormat, frequency, scaler or 1.0)
+    if mixer == nil then
+        checkError(nil)
+        error(string.format("No mixer from %s to %s", sourceFormat, targetFormat))
+    end
+
+    return setmetatable({__mixerHandle = ffi.gc(mixer, lib.SoapySDRConverterMixer_unmake)}, ConverterMixer_mt)
+end
+
+---
+-- Convert and mix a buffer, advancing the oscillator by numElems samples.
+--
+-- @param src a LuaJIT FFI buffer in the source format
+-- @param dst a LuaJIT FFI buffer in the target format
+-- @tparam uint numElems the number of elements to convert
+function ConverterMixer:execute(src, dst, numElems)
+    lib.SoapySDRConverterMixer_execute(self.__mixerHandle, src, dst, numElems)
+end
+
+---
+-- Set the shift in cycles per sample, the phase is kept.
+-- @tparam number frequency the shift in cycles per sample
+function ConverterMixer:setFrequency(frequency)
+    lib.SoapySDRConverterMixer_setFrequency(self.__mixerHandle, frequency)
+end
+
+---
+-- Get the shift in cycles per sample.
+-- @treturn number The shift in cycles per sample
+function ConverterMixer:getFrequency()
+    return tonumber(lib.SoapySDRConverterMixer_getFrequency(self.__mixerHandle))
+end
+
+---
+-- Set the oscillator phase in cycles.
+-- @tparam number phase the phase in cycles, wrapped to [0, 1)
+function ConverterMixer:setPhase(phase)
+    lib.SoapySDRConverterMixer_setPhase(self.__mixerHandle, phase)
+end
+
+---
+-- Get the oscillator phase in cycles.
+-- @treturn number The phase in cycles, in [0, 1)
+function ConverterMixer:getPhase()
+    return tonumber(lib.SoapySDRConverterMixer_getPhase(self.__mixerHandle))
+end
+
+return {Priority, ConverterPlan, ConverterMixer}
@@ -113,6 +113,79 @@ if not __internal.SoapySDR then
 
         const char *SoapySDR_getLibVersion(void);
 
+        /* SoapySDR/Converters.h */
+
+        typedef enum
+        {
+            SOAPY_SDR_CONVERTER_GENERIC    = 0,
+            SOAPY_SDR_CONVERTER_VECTORIZED = 3,
+            SOAPY_SDR_CONVERTER_CUSTOM     = 5
+        } SoapySDRConverterFunctionPriority;
+
+        typedef struct SoapySDRConverterPlan SoapySDRConverterPlan;
+
+        typedef struct SoapySDRConverterMixer SoapySDRConverterMixer;
+
+        typedef struct
+        {
+            size_t numElems;
+            size_t numClipped;
+            double peak;
+            double sumI;
+            double sumQ;
+            double sumPower;
+        } SoapySDRConverterStats;
+
+        char **SoapySDRConverter_listTargetFormats(const char *sourceFormat, size_t *length);
+
+        char **SoapySDRConverter_listSourceFormats(const char *targetFormat, size_t *length);
+
+        char **SoapySDRConverter_listAvailableSourceFormats(size_t *length);
+
+        int SoapySDRConverter_getCPUFeatures(void);
+
+        SoapySDRConverterPlan *SoapySDRConverterPlan_make(const char *sourceFormat, const char *targetFormat, const double scaler);
+
+        SoapySDRConverterPlan *SoapySDRConverterPlan_makeWithPriority(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionPriority priority, const double scaler);
+
+        int SoapySDRConverterPlan_unmake(SoapySDRConverterPlan *plan);
+
+        void SoapySDRConverterPlan_execute(const SoapySDRConverterPlan *plan, const void *srcBuff, void *dstBuff, const size_t numElems);
+
+        int SoapySDRConverterPlan_executeParallel(const SoapySDRConverterPlan *plan, const void *srcBuff, void *dstBuff, const size_t numElems, const size_t numThreads);
+
+        void SoapySDRConverterPlan_executeBatch(const SoapySDRConverterPlan *plan, const void * const *srcBuffs, void * const *dstBuffs, const size_t numBuffs, const size_t numElems);
+
+        int SoapySDRConverterPlan_executeWithStats(const SoapySDRConverterPlan *plan, const void *srcBuff, void *dstBuff, const size_t numElems, SoapySDRConverterStats *stats);
+
+        SoapySDRConverterFunctionPriority SoapySDRConverterPlan_getPriority(const SoapySDRConverterPlan *plan);
+
+        size_t SoapySDRConverterPlan_getSourceSize(const SoapySDRConverterPlan *plan);
+
+        size_t SoapySDRConverterPlan_getTargetSize(const SoapySDRConverterPlan *plan);
+
+        bool SoapySDRConverterPlan_supportsInPlace(const SoapySDRConverterPlan *plan);
+
+        const char *SoapySDRConverterPlan_getSourceFormat(const SoapySDRConverterPlan *plan);
+
+        const char *SoapySDRConverterPlan_getTargetFormat(const SoapySDRConverterPlan *plan);
+
+        double SoapySDRConverterPlan_getScaler(const SoapySDRConverterPlan *plan);
+
+        SoapySDRConverterMixer *SoapySDRConverterMixer_make(const char *sourceFormat, const char *targetFormat, const double frequency, const double scaler);
+
+        int SoapySDRConverterMixer_unmake(SoapySDRConverterMixer *mixer);
+
+        void SoapySDRConverterMixer_execute(SoapySDRConverterMixer *mixer, const void *srcBuff, void *dstBuff, const size_t numElems);
+
+        void SoapySDRConverterMixer_setFrequency(SoapySDRConverterMixer *mixer, const double frequency);
+
+        double SoapySDRConverterMixer_getFrequency(const SoapySDRConverterMixer *mixer);
+
+        void SoapySDRConverterMixer_setPhase(SoapySDRConverterMixer *mixer, const double phase);
+
+        double SoapySDRConverterMixer_getPhase(const SoapySDRConverterMixer *mixer);
+
         /* SoapySDR/Device.h */
 
         typedef struct SoapySDRDevice SoapySDRDevice;
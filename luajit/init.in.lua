@@ -9,6 +9,7 @@ local ffi = require("ffi")
 local lib = require("SoapySDR.Lib")
 
 local enumerateDevices, Device = unpack(require("SoapySDR.Device"))
+local ConverterPriority, ConverterPlan, ConverterMixer = unpack(require("SoapySDR.Converter"))
 
 local SoapySDR =
 {
@@ -211,6 +212,9 @@ local SoapySDR =
     enumerateDevices = enumerateDevices,
 
     Device = Device,
+    ConverterPriority = ConverterPriority,
+    ConverterPlan = ConverterPlan,
+    ConverterMixer = ConverterMixer,
     Logger = require("SoapySDR.Logger"),
     Time = require("SoapySDR.Time")
 }
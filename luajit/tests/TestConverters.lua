@@ -0,0 +1,81 @@
+-- SPDX-License-Identifier: BSL-1.0
+
+SoapySDR = require("SoapySDR")
+
+local ffi = require("ffi")
+luaunit = require("luaunit")
+
+local numElems = 64
+
+local function fillCS16(buff)
+    for i = 0,numElems*2-1 do
+        buff[i] = ((i * 1103) % 65536) - 32768
+    end
+end
+
+function testConverterPlan()
+    local plan = SoapySDR.ConverterPlan.new(SoapySDR.Format.CS16, SoapySDR.Format.CF32, 0.5)
+    luaunit.assertEquals(plan:getSourceFormat(), SoapySDR.Format.CS16)
+    luaunit.assertEquals(plan:getTargetFormat(), SoapySDR.Format.CF32)
+    luaunit.assertEquals(plan:getScaler(), 0.5)
+    luaunit.assertEquals(plan:getSourceSize(), 4)
+    luaunit.assertEquals(plan:getTargetSize(), 8)
+
+    local src = ffi.new("int16_t[?]", numElems*2)
+    local dst = ffi.new("float[?]", numElems*2)
+    fillCS16(src)
+    plan:execute(src, dst, numElems)
+    for i = 0,numElems*2-1 do
+        luaunit.assertAlmostEquals(dst[i], src[i] / 32768 * 0.5, 1e-6)
+    end
+
+    local parallel = ffi.new("float[?]", numElems*2)
+    plan:executeParallel(src, parallel, numElems, 2)
+    for i = 0,numElems*2-1 do
+        luaunit.assertEquals(parallel[i], dst[i])
+    end
+
+    luaunit.assertFalse(plan:supportsInPlace())
+    luaunit.assertTrue(SoapySDR.ConverterPlan.new(SoapySDR.Format.CF32, SoapySDR.Format.CS16):supportsInPlace())
+    local generic = SoapySDR.ConverterPlan.new(SoapySDR.Format.CS16, SoapySDR.Format.CF32, 1.0, SoapySDR.ConverterPriority.GENERIC)
+    luaunit.assertEquals(generic:getPriority(), SoapySDR.ConverterPriority.GENERIC)
+
+    luaunit.assertError(SoapySDR.ConverterPlan.new, SoapySDR.Format.CS16, "NOT_A_FORMAT")
+end
+
+function testConverterPlanBatch()
+    local plan = SoapySDR.ConverterPlan.new(SoapySDR.Format.CS16, SoapySDR.Format.CF32)
+    local src0 = ffi.new("int16_t[?]", numElems*2)
+    local src1 = ffi.new("int16_t[?]", numElems*2)
+    local dst0 = ffi.new("float[?]", numElems*2)
+    local dst1 = ffi.new("float[?]", numElems*2)
+    fillCS16(src0)
+    fillCS16(src1)
+    src1[0] = 0
+
+    plan:executeBatch(ffi.new("int16_t*[2]", {src0, src1}), ffi.new("float*[2]", {dst0, dst1}), 2, numElems)
+    luaunit.assertEquals(dst0[0], -1.0)
+    luaunit.assertEquals(dst1[0], 0.0)
+    luaunit.assertEquals(dst0[1], dst1[1])
+
+    local stats = plan:executeWithStats(src0, dst0, numElems)
+    luaunit.assertEquals(tonumber(stats.numElems), numElems)
+    luaunit.assertEquals(stats.peak, 1.0)
+end
+
+function testConverterMixer()
+    local mixer = SoapySDR.ConverterMixer.new(SoapySDR.Format.CF32, SoapySDR.Format.CF32, 0.25)
+    local src = ffi.new("float[?]", numElems*2)
+    local dst = ffi.new("float[?]", numElems*2)
+    for i = 0,numElems-1 do
+        src[2*i] = 1.0
+    end
+
+    mixer:execute(src, dst, numElems)
+    luaunit.assertAlmostEquals(dst[2], 0.0, 1e-6)
+    luaunit.assertAlmostEquals(dst[3], 1.0, 1e-6)
+    luaunit.assertAlmostEquals(mixer:getPhase(), 0.0, 1e-9)
+end
+
+local runner = luaunit.LuaUnit.new()
+os.exit(runner:runSuite())
@@ -14,6 +14,7 @@ namespace Pothosware.SoapySDR
     {
         internal Device _device = null;
         internal StreamHandle _streamHandle = null;
+        internal DirectAccessEmulation _emulation = null;
         protected bool _active = false;
 
         /// <summary>
@@ -62,6 +63,27 @@ namespace Pothosware.SoapySDR
         /// </summary>
         public ulong MTU => _device.GetStreamMTUInternal(_streamHandle);
 
+        /// <summary>
+        /// The number of direct access buffers this stream can provide, or 0 if unsupported.
+        /// </summary>
+        public ulong NumDirectAccessBuffers => _device.GetNumDirectAccessBuffersInternal(_streamHandle);
+
+        /// <summary>
+        /// Emulate direct buffer access when the driver does not provide it.
+        /// The emulation lasts until the stream is closed.
+        /// </summary>
+        /// <param name="numBuffs">The number of buffers in the pool.</param>
+        public void EnableDirectAccessEmulation(uint numBuffs = 4)
+        {
+            if (_streamHandle != null)
+            {
+                var direction = (this is RxStream) ? Direction.Rx : Direction.Tx;
+                _emulation?.Dispose();
+                _emulation = _device.EnableDirectAccessEmulationInternal(_streamHandle, direction, numBuffs);
+            }
+            else throw new InvalidOperationException("Stream is closed");
+        }
+
         /// <summary>
         /// Activate the stream to prepare it for read/write operations.
         /// </summary>
@@ -131,6 +153,10 @@ namespace Pothosware.SoapySDR
         {
             if (_streamHandle != null)
             {
+                // A later stream at the same address must not inherit the buffers
+                _emulation?.Dispose();
+                _emulation = null;
+
                 _device.CloseStreamInternal(_streamHandle);
                 _streamHandle = null;
             }
@@ -79,6 +79,7 @@ using System.Linq;"
 %ignore SoapySDR::Device::readStream;
 %ignore SoapySDR::Device::writeStream;
 %ignore SoapySDR::Device::readStreamStatus;
+%ignore SoapySDR::Device::enableDirectAccessEmulation;
 %ignore SoapySDR::Device::getNumDirectAccessBuffers;
 %ignore SoapySDR::Device::getDirectAccessBufferAddrs;
 %ignore SoapySDR::Device::acquireReadBuffer;
@@ -404,6 +405,12 @@ using System.Linq;"
 %feature("compactdefaultargs", "0") setHardwareTime;
 %feature("compactdefaultargs", "0") readUART;
 
+// The emulation handle is opaque, it only keeps the emulation enabled
+%include <std_shared_ptr.i>
+%shared_ptr(SoapySDR::DirectAccessEmulation)
+%nodefaultctor SoapySDR::DirectAccessEmulation;
+namespace SoapySDR { class DirectAccessEmulation {}; }
+
 %include <SoapySDR/Device.hpp>
 
 %csmethodmodifiers SoapySDR::Device::SetupStreamInternal "internal";
@@ -414,6 +421,8 @@ using System.Linq;"
 %csmethodmodifiers SoapySDR::Device::ReadStreamInternal "internal";
 %csmethodmodifiers SoapySDR::Device::WriteStreamInternal "internal";
 %csmethodmodifiers SoapySDR::Device::ReadStreamStatusInternal "internal";
+%csmethodmodifiers SoapySDR::Device::EnableDirectAccessEmulationInternal "internal";
+%csmethodmodifiers SoapySDR::Device::GetNumDirectAccessBuffersInternal "internal";
 
 // Internal bridge functions
 %extend SoapySDR::Device
@@ -457,6 +466,24 @@ using System.Linq;"
         return self->getStreamMTU(streamHandle.stream);
     }
 
+    std::shared_ptr<SoapySDR::DirectAccessEmulation> EnableDirectAccessEmulationInternal(
+        const SoapySDR::CSharp::StreamHandle& streamHandle,
+        const SoapySDR::CSharp::Direction direction,
+        const size_t numBuffs)
+    {
+        return self->enableDirectAccessEmulation(
+            streamHandle.stream,
+            int(direction),
+            streamHandle.format,
+            streamHandle.channels.size(),
+            numBuffs);
+    }
+
+    size_t GetNumDirectAccessBuffersInternal(const SoapySDR::CSharp::StreamHandle& streamHandle)
+    {
+        return self->getNumDirectAccessBuffers(streamHandle.stream);
+    }
+
     SoapySDR::CSharp::ErrorCode ActivateStreamInternal(
         const SoapySDR::CSharp::StreamHandle& streamHandle,
         const SoapySDR::CSharp::StreamFlags flags,
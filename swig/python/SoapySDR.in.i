@@ -273,6 +273,12 @@ def registerLogHandler(handler):
 // functions anyway, making this a false positive warning message.
 %warnfilter(509) SoapySDR::Device::make;
 
+//the emulation handle is opaque, it only keeps the emulation enabled
+%include <std_shared_ptr.i>
+%shared_ptr(SoapySDR::DirectAccessEmulation)
+%nodefaultctor SoapySDR::DirectAccessEmulation;
+namespace SoapySDR { class DirectAccessEmulation {}; }
+
 %nodefaultctor SoapySDR::Device;
 %include <SoapySDR/Device.hpp>
 
@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Buffer.hpp>
+#include <SoapySDR/Buffer.h>
+#include <SoapySDR/Device.hpp>
+#include <stdexcept>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/***********************************************************************
+ * A device that reports NUMA nodes for its RX channels and hardware
+ **********************************************************************/
+class MockDevice : public SoapySDR::Device
+{
+public:
+    SoapySDR::Kwargs getHardwareInfo(void) const
+    {
+        SoapySDR::Kwargs info;
+        info["numa_node"] = "0";
+        return info;
+    }
+
+    SoapySDR::Kwargs getChannelInfo(const int direction, const size_t channel) const
+    {
+        SoapySDR::Kwargs info;
+        if (direction == SOAPY_SDR_RX and channel == 1) info["numa_node"] = "1";
+        if (direction == SOAPY_SDR_RX and channel == 2) info["numa_node"] = "none";
+        return info;
+    }
+};
+
+static bool checkAlignment(void)
+{
+    const size_t alignments[] = {8, 64, 4096};
+    for (const size_t alignment : alignments)
+    {
+        SoapySDR::BufferArgs args;
+        args.alignment = alignment;
+        for (size_t size = 0; size < 5000; size += 1000)
+        {
+            SoapySDR::Buffer buff(size, args);
+            if (buff.data() == nullptr or buff.size() != size) return false;
+            if (uintptr_t(buff.data()) % alignment != 0) return false;
+            std::memset(buff.data(), 0xff, size);
+        }
+    }
+
+    SoapySDR::BufferArgs args;
+    args.alignment = 48;
+    try
+    {
+        SoapySDR::Buffer buff(64, args);
+        return false;
+    }
+    catch (const std::invalid_argument &) {}
+    return true;
+}
+
+static bool checkBestEffort(void)
+{
+    //huge pages, locking and NUMA placement fall back to plain memory
+    SoapySDR::BufferArgs args;
+    args.hugePages = true;
+    args.lockMemory = true;
+    args.numaNode = 0;
+    const size_t size = size_t(3) << 20;
+    SoapySDR::Buffer buff(size, args);
+    if (buff.data() == nullptr or uintptr_t(buff.data()) % SOAPY_SDR_BUFFER_ALIGNMENT != 0) return false;
+    std::memset(buff.data(), 0x5a, size);
+    printf("  hugePages=%d, locked=%d, numaNode=%d\n", int(buff.usesHugePages()), int(buff.isLocked()), buff.getNumaNode());
+    if (buff.getNumaNode() != -1 and buff.getNumaNode() != 0) return false;
+
+    //a NUMA node that does not exist is not reported
+    args.hugePages = false;
+    args.lockMemory = false;
+    args.numaNode = 1000;
+    SoapySDR::Buffer far(4096, args);
+    return far.data() != nullptr and far.getNumaNode() == -1;
+}
+
+static bool checkMove(void)
+{
+    SoapySDR::Buffer empty;
+    if (empty.data() != nullptr or empty.size() != 0 or empty.getNumaNode() != -1) return false;
+
+    SoapySDR::Buffer a(100);
+    void *data = a.data();
+    SoapySDR::Buffer b(std::move(a));
+    if (a.data() != nullptr or b.data() != data or b.size() != 100) return false;
+    a = std::move(b);
+    if (b.data() != nullptr or a.data() != data) return false;
+
+    std::vector<SoapySDR::Buffer> buffs;
+    for (size_t i = 0; i < 10; i++) buffs.emplace_back(i*10);
+    for (size_t i = 0; i < 10; i++)
+    {
+        if (buffs[i].size() != i*10) return false;
+    }
+
+    void *released = a.release();
+    if (released != data or a.data() != nullptr) return false;
+    SoapySDR::Buffer::free(released);
+    return true;
+}
+
+static bool checkCAPI(void)
+{
+    SoapySDRBufferArgs args;
+    SoapySDRBufferArgs_init(&args);
+    if (args.alignment != SOAPY_SDR_BUFFER_ALIGNMENT or args.hugePages or args.lockMemory or args.numaNode != -1) return false;
+
+    void *buff = SoapySDR_allocBuffer(1000, nullptr);
+    if (buff == nullptr or uintptr_t(buff) % SOAPY_SDR_BUFFER_ALIGNMENT != 0) return false;
+    SoapySDR_freeBuffer(buff);
+    SoapySDR_freeBuffer(nullptr);
+
+    args.alignment = 256;
+    buff = SoapySDR_allocBuffer(1000, &args);
+    if (buff == nullptr or uintptr_t(buff) % 256 != 0) return false;
+    SoapySDR_freeBuffer(buff);
+
+    //errors are reported through the last error
+    args.alignment = 3;
+    if (SoapySDR_allocBuffer(1000, &args) != nullptr) return false;
+    return std::strlen(SoapySDRDevice_lastError()) != 0;
+}
+
+static bool checkDeviceNumaNode(void)
+{
+    MockDevice mock;
+    if (SoapySDR::getNumaNode(&mock, SOAPY_SDR_RX, 1) != 1) return false;
+    if (SoapySDR::getNumaNode(&mock, SOAPY_SDR_RX, 0) != 0) return false;
+    if (SoapySDR::getNumaNode(&mock, SOAPY_SDR_RX, 2) != 0) return false;
+
+    const SoapySDRDevice *device = reinterpret_cast<const SoapySDRDevice *>(static_cast<const SoapySDR::Device *>(&mock));
+    if (SoapySDRDevice_getNumaNode(device, SOAPY_SDR_RX, 1) != 1) return false;
+
+    //a device without the key
+    SoapySDR::Device plain;
+    return SoapySDR::getNumaNode(&plain, SOAPY_SDR_TX, 0) == -1;
+}
+
+int main(void)
+{
+    printf("Check buffer alignment:\n");
+    if (not checkAlignment()) return EXIT_FAILURE;
+    printf("Check huge pages, locking and NUMA placement:\n");
+    if (not checkBestEffort()) return EXIT_FAILURE;
+    printf("Check buffer ownership:\n");
+    if (not checkMove()) return EXIT_FAILURE;
+    printf("Check the C API:\n");
+    if (not checkCAPI()) return EXIT_FAILURE;
+    printf("Check the NUMA node of device channels:\n");
+    if (not checkDeviceNumaNode()) return EXIT_FAILURE;
+
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,414 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/BufferedStream.hpp>
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Errors.hpp>
+#include <SoapySDR/Time.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+/***********************************************************************
+ * A CS16 device that receives a fixed number of chunks of a counting
+ * sequence, and then times out until it is deactivated
+ **********************************************************************/
+class MockDevice : public SoapySDR::Device
+{
+public:
+    MockDevice(const size_t numChunks, const size_t overflowAt = size_t(-1)):
+        numChunks(numChunks),
+        overflowAt(overflowAt),
+        numCalls(0),
+        numTimeouts(0),
+        rxCount(0),
+        active(false)
+    {
+        return;
+    }
+
+    size_t getStreamMTU(SoapySDR::Stream *) const
+    {
+        return 100;
+    }
+
+    double getSampleRate(const int, const size_t) const
+    {
+        return 1e6;
+    }
+
+    int activateStream(SoapySDR::Stream *, const int, const long long, const size_t)
+    {
+        active = true;
+        return 0;
+    }
+
+    int deactivateStream(SoapySDR::Stream *, const int, const long long)
+    {
+        active = false;
+        return 0;
+    }
+
+    int readStream(SoapySDR::Stream *, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+    {
+        if (numCalls == numChunks)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(std::min(timeoutUs, 1000L)));
+            numTimeouts++;
+            return SOAPY_SDR_TIMEOUT;
+        }
+        if (numCalls++ == overflowAt) return SOAPY_SDR_OVERFLOW;
+
+        int16_t *buff = (int16_t *)buffs[0];
+        for (size_t i = 0; i < numElems*2; i++) buff[i] = int16_t(rxCount*2 + i);
+        flags = SOAPY_SDR_HAS_TIME;
+        timeNs = SoapySDR::ticksToTimeNs((long long)rxCount, 1e6);
+        rxCount += numElems;
+        return int(numElems);
+    }
+
+    //wait until the reader thread has handled every chunk
+    void waitDone(void) const
+    {
+        while (numTimeouts.load() == 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    const size_t numChunks;
+    const size_t overflowAt;
+    std::atomic<size_t> numCalls;
+    std::atomic<size_t> numTimeouts;
+    size_t rxCount;
+    std::atomic<bool> active;
+};
+
+static SoapySDR::Stream *const stream = reinterpret_cast<SoapySDR::Stream *>(1);
+
+//read until a timeout, checking the sequence and returning the error codes seen
+static bool readAll(SoapySDR::BufferedRxStream &rx, const size_t readElems, std::vector<int> &errors, size_t &total)
+{
+    std::vector<int16_t> buff(readElems*2);
+    void *buffs[1] = {buff.data()};
+    while (true)
+    {
+        int flags(0);
+        long long timeNs(0);
+        const int ret = rx.read(buffs, readElems, flags, timeNs, 50000);
+        if (ret == SOAPY_SDR_TIMEOUT) return true;
+        if (ret < 0)
+        {
+            errors.push_back(ret);
+            continue;
+        }
+
+        //the timestamp locates the samples after a gap
+        if ((flags & SOAPY_SDR_HAS_TIME) == 0) return false;
+        const size_t first = size_t(SoapySDR::timeNsToTicks(timeNs, 1e6));
+        if (first < total) return false;
+        total = first;
+
+        const bool fragment = (flags & SOAPY_SDR_MORE_FRAGMENTS) != 0;
+        if (fragment != ((total + ret) % 100 != 0)) return false;
+        for (size_t i = 0; i < size_t(ret)*2; i++)
+        {
+            if (buff[i] != int16_t(total*2 + i)) return false;
+        }
+        total += ret;
+    }
+}
+
+static bool checkRead(void)
+{
+    MockDevice device(10);
+    SoapySDR::BufferedRxStream rx(&device, stream, SOAPY_SDR_CS16, {0}, 16);
+    if (rx.getDepth() != 16 or rx.getChunkElems() != 100) return false;
+    if (rx.activate() != 0 or not device.active) return false;
+    device.waitDone();
+
+    //reads smaller than a chunk return the chunk in fragments
+    std::vector<int> errors;
+    size_t total(0);
+    if (not readAll(rx, 64, errors, total)) return false;
+    if (rx.deactivate() != 0 or device.active) return false;
+    if (total != 1000 or not errors.empty()) return false;
+    return rx.getHighWaterMark() == 10 and rx.getNumDropped() == 0 and rx.getNumBuffered() == 0;
+}
+
+static bool checkDrops(void)
+{
+    MockDevice device(50);
+    SoapySDR::BufferedRxStream rx(&device, stream, SOAPY_SDR_CS16, {0}, 8);
+    rx.activate();
+    device.waitDone();
+    if (rx.getNumBuffered() != 8 or rx.getHighWaterMark() != 8) return false;
+    if (rx.getNumDropped() != (50-8)*100) return false;
+
+    //the discarded chunks are reported as one overflow after the buffered chunks
+    std::vector<int> errors;
+    size_t total(0);
+    if (not readAll(rx, 100, errors, total)) return false;
+    rx.deactivate();
+    if (errors.size() != 1 or errors[0] != SOAPY_SDR_OVERFLOW) return false;
+    if (total != 800) return false;
+
+    rx.resetCounters();
+    return rx.getNumDropped() == 0 and rx.getHighWaterMark() == 0;
+}
+
+static bool checkOverflow(void)
+{
+    MockDevice device(10, 3);
+    SoapySDR::BufferedRxStream rx(&device, stream, SOAPY_SDR_CS16);
+    rx.activate();
+    device.waitDone();
+
+    std::vector<int> errors;
+    size_t total(0);
+    if (not readAll(rx, 100, errors, total)) return false;
+    rx.deactivate();
+    if (errors.size() != 1 or errors[0] != SOAPY_SDR_OVERFLOW) return false;
+    return total == 900 and rx.getNumOverflows() == 1 and rx.getNumDropped() == 0;
+}
+
+/***********************************************************************
+ * A CS16 device that accepts up to 60 elements per write, and records
+ * every accepted write, with configurable errors
+ **********************************************************************/
+struct TxRecord
+{
+    size_t numElems;
+    int flags;
+    long long timeNs;
+};
+
+class TxMockDevice : public SoapySDR::Device
+{
+public:
+    TxMockDevice(void):
+        activateResult(0),
+        writeResult(0),
+        lateTimeNs(-1),
+        underflowNext(false),
+        statusUnderflow(false),
+        active(false),
+        numActivations(0)
+    {
+        return;
+    }
+
+    size_t getStreamMTU(SoapySDR::Stream *) const
+    {
+        return 100;
+    }
+
+    int activateStream(SoapySDR::Stream *, const int, const long long, const size_t)
+    {
+        numActivations++;
+        if (activateResult != 0) return activateResult;
+        active = true;
+        return 0;
+    }
+
+    int deactivateStream(SoapySDR::Stream *, const int, const long long)
+    {
+        active = false;
+        return 0;
+    }
+
+    int writeStream(SoapySDR::Stream *, const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long)
+    {
+        if (not active) return SOAPY_SDR_STREAM_ERROR;
+        if (writeResult != 0) return writeResult;
+        if (underflowNext.exchange(false)) return SOAPY_SDR_UNDERFLOW;
+        if ((flags & SOAPY_SDR_HAS_TIME) != 0 and timeNs == lateTimeNs) return SOAPY_SDR_TIME_ERROR;
+
+        //the burst only ends when the last element is accepted
+        const size_t n = std::min<size_t>(numElems, 60);
+        if (n < numElems) flags &= ~SOAPY_SDR_END_BURST;
+        const int16_t *buff = (const int16_t *)buffs[0];
+        samples.insert(samples.end(), buff, buff+n*2);
+        TxRecord record = {n, flags, timeNs};
+        records.push_back(record);
+        return int(n);
+    }
+
+    int readStreamStatus(SoapySDR::Stream *, size_t &, int &, long long &, const long)
+    {
+        if (statusUnderflow.exchange(false)) return SOAPY_SDR_UNDERFLOW;
+        return SOAPY_SDR_TIMEOUT;
+    }
+
+    int activateResult;
+    int writeResult;
+    long long lateTimeNs;
+    std::atomic<bool> underflowNext;
+    std::atomic<bool> statusUnderflow;
+    std::atomic<bool> active;
+    std::atomic<size_t> numActivations;
+    std::vector<int16_t> samples;
+    std::vector<TxRecord> records;
+};
+
+//queue a burst of a counting sequence, one write per chunk
+static bool writeBurst(SoapySDR::BufferedTxStream &tx, const size_t numElems, const long long timeNs)
+{
+    std::vector<int16_t> buff(numElems*2);
+    for (size_t i = 0; i < buff.size(); i++) buff[i] = int16_t(i);
+    size_t total = 0;
+    while (total < numElems)
+    {
+        const void *buffs[1] = {buff.data()+total*2};
+        int flags = SOAPY_SDR_END_BURST;
+        if (total == 0) flags |= SOAPY_SDR_HAS_TIME;
+        const int ret = tx.write(buffs, numElems-total, flags, timeNs);
+        if (ret <= 0) return false;
+        if ((total+ret < numElems) != ((flags & SOAPY_SDR_END_BURST) == 0)) return false;
+        total += ret;
+    }
+    return true;
+}
+
+static bool checkPrefill(void)
+{
+    TxMockDevice device;
+    SoapySDR::BufferedTxStream tx(&device, stream, SOAPY_SDR_CS16, {0}, 16, 0, 4);
+    if (tx.getChunkElems() != 100 or tx.getPrefill() != 4) return false;
+    if (tx.activate() != 0) return false;
+
+    //the stream waits for the prefill, the last chunk of the burst makes ten
+    std::vector<int16_t> buff(300*2);
+    const void *buffs[1] = {buff.data()};
+    int flags(0);
+    if (tx.write(buffs, 300, flags) != 100 or tx.write(buffs, 300, flags) != 100) return false;
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    if (device.active or tx.getNumBuffered() != 2) return false;
+    device.samples.clear();
+
+    if (not writeBurst(tx, 800, 5000)) return false;
+    if (tx.flush() != 0 or not device.active or device.numActivations != 1) return false;
+
+    //chunks are split by the driver, the time goes with the first element of the burst
+    const auto &records = device.records;
+    size_t numTimed(0), numEnds(0), total(0);
+    for (size_t i = 0; i < records.size(); i++)
+    {
+        if ((records[i].flags & SOAPY_SDR_HAS_TIME) != 0)
+        {
+            numTimed++;
+            if (total != 200 or records[i].timeNs != 5000) return false;
+        }
+        total += records[i].numElems;
+        if ((records[i].flags & SOAPY_SDR_END_BURST) != 0)
+        {
+            numEnds++;
+            if (total != 1000) return false;
+        }
+    }
+    if (numTimed != 1 or numEnds != 1 or total != 1000) return false;
+    for (size_t i = 0; i < 800*2; i++)
+    {
+        if (device.samples[200*2+i] != int16_t(i)) return false;
+    }
+
+    if (tx.deactivate() != 0 or device.active) return false;
+    return tx.getNumUnderflows() == 0 and tx.getNumLate() == 0;
+}
+
+static bool checkShortBurst(void)
+{
+    TxMockDevice device;
+    SoapySDR::BufferedTxStream tx(&device, stream, SOAPY_SDR_CS16, {0}, 16, 0, 8);
+    tx.activate();
+    if (not writeBurst(tx, 50, 0)) return false;
+    if (tx.flush() != 0 or not device.active) return false;
+    tx.deactivate();
+    return device.records.size() == 1 and device.records[0].numElems == 50;
+}
+
+static bool checkUnderflowAndLate(void)
+{
+    TxMockDevice device;
+    device.lateTimeNs = 1000;
+    SoapySDR::BufferedTxStream tx(&device, stream, SOAPY_SDR_CS16);
+    if (tx.activate() != 0 or not device.active) return false;
+
+    //a late burst drops its first chunk, the rest of the burst is sent
+    device.underflowNext = true;
+    device.statusUnderflow = true;
+    if (not writeBurst(tx, 100, 0)) return false;
+    if (not writeBurst(tx, 200, 1000)) return false;
+    if (tx.flush() != 0) return false;
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    tx.deactivate();
+
+    if (tx.getNumUnderflows() != 2 or tx.getNumLate() != 1) return false;
+    size_t total(0);
+    for (const auto &record : device.records) total += record.numElems;
+    if (total != 200) return false;
+
+    tx.resetCounters();
+    return tx.getNumUnderflows() == 0 and tx.getNumLate() == 0;
+}
+
+static bool checkActivateError(void)
+{
+    TxMockDevice device;
+    device.activateResult = SOAPY_SDR_NOT_SUPPORTED;
+    SoapySDR::BufferedTxStream tx(&device, stream, SOAPY_SDR_CS16, {0}, 16, 0, 1);
+    if (tx.activate() != 0) return false;
+    if (not writeBurst(tx, 100, 0)) return false;
+    if (tx.flush() != SOAPY_SDR_NOT_SUPPORTED) return false;
+
+    std::vector<int16_t> buff(100*2);
+    const void *buffs[1] = {buff.data()};
+    int flags(0);
+    if (tx.write(buffs, 100, flags) != SOAPY_SDR_NOT_SUPPORTED) return false;
+    return tx.deactivate() == 0 and tx.getNumBuffered() == 0;
+}
+
+static bool checkFlush(void)
+{
+    //flush starts a stream that is short of its prefill
+    TxMockDevice device;
+    SoapySDR::BufferedTxStream tx(&device, stream, SOAPY_SDR_CS16, {0}, 16, 0, 4);
+    tx.activate();
+    std::vector<int16_t> buff(200*2);
+    const void *buffs[1] = {buff.data()};
+    int flags(0);
+    if (tx.write(buffs, 100, flags) != 100 or tx.write(buffs, 100, flags) != 100) return false;
+    if (tx.flush(1000000) != 0 or not device.active or device.records.size() != 4) return false;
+
+    //a write error wakes the flush long before its timeout
+    device.writeResult = SOAPY_SDR_STREAM_ERROR;
+    if (tx.write(buffs, 100, flags) != 100) return false;
+    const auto t0 = std::chrono::steady_clock::now();
+    if (tx.flush(5000000) != SOAPY_SDR_STREAM_ERROR) return false;
+    if (std::chrono::steady_clock::now() - t0 > std::chrono::seconds(1)) return false;
+    return tx.deactivate() == 0;
+}
+
+int main(void)
+{
+    printf("Check buffered read:\n");
+    if (not checkRead()) return EXIT_FAILURE;
+    printf("Check dropped chunks:\n");
+    if (not checkDrops()) return EXIT_FAILURE;
+    printf("Check driver overflow:\n");
+    if (not checkOverflow()) return EXIT_FAILURE;
+    printf("Check buffered write with prefill:\n");
+    if (not checkPrefill()) return EXIT_FAILURE;
+    printf("Check short burst:\n");
+    if (not checkShortBurst()) return EXIT_FAILURE;
+    printf("Check underflow and late:\n");
+    if (not checkUnderflowAndLate()) return EXIT_FAILURE;
+    printf("Check activation error:\n");
+    if (not checkActivateError()) return EXIT_FAILURE;
+    printf("Check flush:\n");
+    if (not checkFlush()) return EXIT_FAILURE;
+
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
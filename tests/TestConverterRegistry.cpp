@@ -0,0 +1,1021 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/ConverterPlan.hpp>
+#include <SoapySDR/ConverterMixer.hpp>
+#include <SoapySDR/ConverterPrimitives.hpp>
+#include <SoapySDR/ChannelConverterRegistry.hpp>
+#include <SoapySDR/Converters.h>
+#include <SoapySDR/Formats.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include <atomic>
+#include <cmath>
+
+//deterministic source data: random bits for integer formats,
+//random values in a range that cannot overflow for float formats
+static void fillSource(const std::string &format, std::vector<char> &buff, const float range)
+{
+    std::srand(42);
+    if (format == SOAPY_SDR_CF32 or format == SOAPY_SDR_F32)
+    {
+        auto *p = (float *)buff.data();
+        for (size_t i = 0; i < buff.size()/sizeof(float); i++)
+        {
+            p[i] = range*(2.0f*std::rand()/RAND_MAX - 1.0f);
+        }
+    }
+    else
+    {
+        for (auto &b : buff) b = char(std::rand());
+    }
+}
+
+static bool checkBitExact(const std::string &source, const std::string &target, const double scaler)
+{
+    const auto generic = SoapySDR::ConverterRegistry::getFunction(source, target, SoapySDR::ConverterRegistry::GENERIC);
+    const auto vectorized = SoapySDR::ConverterRegistry::getFunction(source, target, SoapySDR::ConverterRegistry::VECTORIZED);
+    const size_t srcSize = SoapySDR::formatToSize(source);
+    const size_t dstSize = SoapySDR::formatToSize(target);
+
+    //cover every tail length and a buffer much longer than any vector width
+    std::vector<size_t> lengths;
+    for (size_t n = 0; n <= 40; n++) lengths.push_back(n);
+    lengths.push_back(1021);
+
+    for (const size_t numElems : lengths)
+    {
+        std::vector<char> src(numElems*srcSize+1);
+        std::vector<char> out0(numElems*dstSize+1), out1(numElems*dstSize+1);
+        //offset by one byte to exercise unaligned loads and stores
+        fillSource(source, src, float(0.9/std::max(scaler, 1.0)));
+        std::memmove(src.data()+1, src.data(), numElems*srcSize);
+        generic(src.data()+1, out0.data()+1, numElems, scaler);
+        vectorized(src.data()+1, out1.data()+1, numElems, scaler);
+        if (out0 != out1)
+        {
+            printf("FAIL: %s -> %s differs, numElems=%d, scaler=%f\n",
+                source.c_str(), target.c_str(), int(numElems), scaler);
+            return false;
+        }
+    }
+    return true;
+}
+
+//packing must keep the most significant bits of every component
+static bool checkPackedRoundTrip(const std::string &packed, const size_t bits)
+{
+    const auto toPacked = SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS16, packed);
+    const auto fromPacked = SoapySDR::ConverterRegistry::getFunction(packed, SOAPY_SDR_CS16);
+    const size_t numElems = 1021;
+    std::vector<char> in(numElems*4), wire(numElems*SoapySDR::formatToSize(packed)), out(numElems*4);
+    fillSource(SOAPY_SDR_CS16, in, 1.0f);
+    toPacked(in.data(), wire.data(), numElems, 1.0);
+    fromPacked(wire.data(), out.data(), numElems, 1.0);
+    const auto *a = (const int16_t *)in.data();
+    const auto *b = (const int16_t *)out.data();
+    const int16_t mask = int16_t(0xffff << (16-bits));
+    for (size_t i = 0; i < numElems*2; i++)
+    {
+        if ((a[i] & mask) != b[i])
+        {
+            printf("FAIL: %s round trip index %d: %d -> %d\n", packed.c_str(), int(i), a[i], b[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+//every real and complex pair of the default formats has a generic converter
+static bool checkGenericMatrix(void)
+{
+    const std::vector<std::string> real = {
+        SOAPY_SDR_F64, SOAPY_SDR_F32, SOAPY_SDR_S32, SOAPY_SDR_U32,
+        SOAPY_SDR_S16, SOAPY_SDR_U16, SOAPY_SDR_S8, SOAPY_SDR_U8};
+    size_t numPairs = 0;
+    for (const auto &source : real)
+    {
+        for (const auto &target : real)
+        {
+            for (const auto &prefix : {"", "C"})
+            {
+                const auto priorities = SoapySDR::ConverterRegistry::listPriorities(prefix+source, prefix+target);
+                if (std::find(priorities.begin(), priorities.end(), SoapySDR::ConverterRegistry::GENERIC) == priorities.end())
+                {
+                    printf("FAIL: no generic converter %s%s -> %s%s\n", prefix, source.c_str(), prefix, target.c_str());
+                    return false;
+                }
+                numPairs++;
+            }
+        }
+    }
+    printf("  %d generic pairs registered\n", int(numPairs));
+
+    //spot check values and scaling across the new formats
+    const double cf64[2] = {0.5, -0.25};
+    int16_t cs16[2];
+    SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CF64, SOAPY_SDR_CS16)(cf64, cs16, 1, 1.0);
+    if (cs16[0] != 16384 or cs16[1] != -8192) return false;
+
+    const int32_t cs32[2] = {1 << 30, -(1 << 29)};
+    double back[2];
+    SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS32, SOAPY_SDR_CF64)(cs32, back, 1, 2.0);
+    if (back[0] != 1.0 or back[1] != -0.5) return false;
+
+    const uint32_t u32 = 0x80000000u + (1u << 24);
+    int8_t s8;
+    SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_U32, SOAPY_SDR_S8)(&u32, &s8, 1, 1.0);
+    if (s8 != 1) return false;
+    return true;
+}
+
+//a plan must produce the same output as the function it resolved
+static bool checkPlan(void)
+{
+    const size_t numElems = 100;
+    std::vector<char> src(numElems*4), out0(numElems*8), out1(numElems*8), out2(numElems*8);
+    fillSource(SOAPY_SDR_CS16, src, 1.0f);
+
+    const SoapySDR::ConverterPlan plan(SOAPY_SDR_CS16, SOAPY_SDR_CF32, 0.5);
+    if (not plan.isValid() or plan.getSourceSize() != 4 or plan.getTargetSize() != 8) return false;
+    if (plan.getPriority() != SoapySDR::ConverterRegistry::listPriorities(SOAPY_SDR_CS16, SOAPY_SDR_CF32).back()) return false;
+    plan.execute(src.data(), out0.data(), numElems);
+    SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS16, SOAPY_SDR_CF32)(src.data(), out1.data(), numElems, 0.5);
+    if (out0 != out1) return false;
+
+    auto *cplan = SoapySDRConverterPlan_makeWithPriority(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SOAPY_SDR_CONVERTER_GENERIC, 0.5);
+    if (cplan == nullptr) return false;
+    SoapySDRConverterPlan_execute(cplan, src.data(), out2.data(), numElems);
+    SoapySDRConverterPlan_unmake(cplan);
+    if (out0 != out2) return false;
+
+    if (SoapySDRConverterPlan_make("CS16", "NOT_A_FORMAT", 1.0) != nullptr) return false;
+    try
+    {
+        SoapySDR::ConverterPlan(SOAPY_SDR_CS16, "NOT_A_FORMAT");
+        return false;
+    }
+    catch (const std::runtime_error &) {}
+    return not SoapySDR::ConverterPlan().isValid();
+}
+
+//the number of threads in this process, or 0 when unknown
+static size_t countThreads(void)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, 8, "Threads:") == 0) return size_t(std::atoi(line.c_str()+8));
+    }
+    return 0;
+}
+
+//parallel execution must match a single call for every chunking
+static bool checkParallel(const std::string &source, const std::string &target)
+{
+    const SoapySDR::ConverterPlan plan(source, target, 0.5);
+    const size_t numElems = (1 << 18) + 37;
+    std::vector<char> src(numElems*plan.getSourceSize()), out0(numElems*plan.getTargetSize()), out1(out0.size());
+    fillSource(source, src, 1.0f);
+    plan.execute(src.data(), out0.data(), numElems);
+    for (const size_t numThreads : {1, 2, 3, 8, 256})
+    {
+        std::fill(out1.begin(), out1.end(), 0);
+        plan.executeParallel(src.data(), out1.data(), numElems, numThreads);
+        if (out0 != out1)
+        {
+            printf("FAIL: %s -> %s parallel differs, numThreads=%d\n", source.c_str(), target.c_str(), int(numThreads));
+            return false;
+        }
+    }
+
+    //the pool never grows past one thread per CPU, however many are requested
+    const size_t numThreads = countThreads();
+    if (numThreads > std::max<size_t>(1, std::thread::hardware_concurrency()))
+    {
+        printf("FAIL: %d threads for %d CPUs\n", int(numThreads), int(std::thread::hardware_concurrency()));
+        return false;
+    }
+    return true;
+}
+
+//a chained plan must match running each hop over the whole buffer
+static bool checkChain(const std::string &source, const std::string &target, const size_t numHops)
+{
+    if (not SoapySDR::ConverterRegistry::listPriorities(source, target).empty()) return false;
+    const auto path = SoapySDR::ConverterRegistry::findPath(source, target);
+    const SoapySDR::ConverterPlan plan(source, target, 0.5);
+    if (path.size() != numHops+1 or plan.getPath() != path or plan.getFunction() != nullptr) return false;
+
+    const size_t numElems = 5000;
+    std::vector<char> src(numElems*plan.getSourceSize()), out(numElems*plan.getTargetSize());
+    fillSource(source, src, 1.0f);
+    plan.execute(src.data(), out.data(), numElems);
+
+    //reference: full-size intermediates with the scaler on the same hop as the plan
+    std::vector<char> in(src), ref;
+    bool scaled = false;
+    for (size_t i = 0; i+1 < path.size(); i++)
+    {
+        const bool isFloat = path[i].find('F') != std::string::npos or path[i+1].find('F') != std::string::npos;
+        const double scaler = (not scaled and (isFloat or i+2 == path.size()))?0.5:1.0;
+        if (scaler != 1.0) scaled = true;
+        ref.resize(numElems*SoapySDR::formatToSize(path[i+1]));
+        SoapySDR::ConverterRegistry::getFunction(path[i], path[i+1])(in.data(), ref.data(), numElems, scaler);
+        in = ref;
+    }
+    if (ref != out)
+    {
+        printf("FAIL: %s -> %s chain differs\n", source.c_str(), target.c_str());
+        return false;
+    }
+    printf("  %s ... PASS\n", [&path](){std::string s; for (const auto &f : path) s += (s.empty()?"":" -> ")+f; return s;}().c_str());
+    return true;
+}
+
+//the default function of each pair is the one at the selected priority
+static bool checkSelectedPriorities(void)
+{
+    size_t numTuned = 0;
+    for (const auto &source : SoapySDR::ConverterRegistry::listAvailableSourceFormats())
+    {
+        for (const auto &target : SoapySDR::ConverterRegistry::listTargetFormats(source))
+        {
+            const auto priorities = SoapySDR::ConverterRegistry::listPriorities(source, target);
+            const auto selected = SoapySDR::ConverterRegistry::getSelectedPriority(source, target);
+            if (std::find(priorities.begin(), priorities.end(), selected) == priorities.end()) return false;
+            if (SoapySDR::ConverterRegistry::getFunction(source, target) != SoapySDR::ConverterRegistry::getFunction(source, target, selected)) return false;
+            const int required = SoapySDR::ConverterRegistry::getRequiredCPUFeatures(source, target, selected);
+            if ((required & ~SoapySDR::ConverterRegistry::getCPUFeatures()) != 0) return false;
+            if (selected != priorities.back()) numTuned++;
+        }
+    }
+    printf("  %d conversions prefer a lower priority\n", int(numTuned));
+    return true;
+}
+
+static void customCopy(const void *srcBuff, void *dstBuff, const size_t numElems, const double)
+{
+    std::memcpy(dstBuff, srcBuff, numElems*4);
+}
+
+//a test pair whose higher priority converter is much slower than its generic one
+static void tuneFastCopy(const void *srcBuff, void *dstBuff, const size_t numElems, const double)
+{
+    std::memcpy(dstBuff, srcBuff, numElems*4);
+}
+
+static void tuneSlowCopy(const void *srcBuff, void *dstBuff, const size_t numElems, const double)
+{
+    const char *src = (const char *)srcBuff;
+    volatile char *dst = (volatile char *)dstBuff;
+    for (size_t pass = 0; pass < 8; pass++)
+    {
+        for (size_t i = 0; i < numElems*4; i++) dst[i] = src[i];
+    }
+}
+
+//a tuned choice holds until a module registers a converter for the pair
+static bool checkTunedPriority(void)
+{
+    typedef SoapySDR::ConverterRegistry CR;
+    const std::string source("TEST_TUNE32"), target("TEST_TUNED32");
+    CR(source, target, CR::GENERIC, &tuneFastCopy);
+    CR(source, target, CR::VECTORIZED, &tuneSlowCopy);
+    if (CR::getSelectedPriority(source, target) != CR::VECTORIZED) return false;
+
+    CR::autotune(true);
+    if (CR::getSelectedPriority(source, target) != CR::GENERIC) return false;
+    if (CR::getFunction(source, target) != &tuneFastCopy) return false;
+
+    CR(source, target, CR::CUSTOM, &customCopy);
+    if (CR::getSelectedPriority(source, target) != CR::CUSTOM) return false;
+    if (CR::getFunction(source, target) != &customCopy) return false;
+
+    //the cache no longer matches the registered priorities, so it is tuned again
+    CR::autotune();
+    return CR::getSelectedPriority(source, target) != CR::VECTORIZED;
+}
+
+//kernels rank by their most capable feature, not by the value of the mask
+static bool checkFeatureRanking(void)
+{
+    typedef SoapySDR::ConverterRegistry CR;
+    const int avx2 = CR::CPU_AVX2, fma = CR::CPU_FMA;
+    if ((CR::getCPUFeatures() & (avx2 | fma)) != (avx2 | fma))
+    {
+        printf("  skipped, no AVX2 and FMA\n");
+        return true;
+    }
+
+    //the FMA mask is the larger value, in either registration order
+    CR("TEST_RANK32", "TEST_RANKA32", CR::CUSTOM, &customCopy, avx2);
+    CR("TEST_RANK32", "TEST_RANKA32", CR::CUSTOM, &tuneFastCopy, fma);
+    CR("TEST_RANK32", "TEST_RANKB32", CR::CUSTOM, &tuneFastCopy, fma);
+    CR("TEST_RANK32", "TEST_RANKB32", CR::CUSTOM, &customCopy, avx2);
+    if (CR::getFunction("TEST_RANK32", "TEST_RANKA32") != &customCopy) return false;
+    if (CR::getFunction("TEST_RANK32", "TEST_RANKB32") != &customCopy) return false;
+
+    //with the same top feature, the kernel that needs more features wins
+    CR("TEST_RANK32", "TEST_RANKC32", CR::CUSTOM, &tuneFastCopy, avx2 | fma);
+    CR("TEST_RANK32", "TEST_RANKC32", CR::CUSTOM, &customCopy, avx2);
+    return CR::getFunction("TEST_RANK32", "TEST_RANKC32") == &tuneFastCopy;
+}
+
+//lookups must stay consistent while another thread registers converters
+//and the snapshots replaced by each registration are freed
+static bool checkConcurrentRegistration(void)
+{
+    typedef SoapySDR::ChannelConverterRegistry CCR;
+    std::atomic<bool> done(false);
+    std::atomic<bool> ok(true);
+    std::vector<std::thread> readers;
+    for (size_t i = 0; i < 3; i++) readers.emplace_back([&]()
+    {
+        while (not done)
+        {
+            if (SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS16, SOAPY_SDR_CF32) == nullptr) ok = false;
+            SoapySDR::ConverterRegistry::listTargetFormats(SOAPY_SDR_CS16);
+            if (CCR::getFunction(SOAPY_SDR_CF32, SOAPY_SDR_CF32, CCR::INTERLEAVE) == nullptr) ok = false;
+            CCR::listTargetFormats(SOAPY_SDR_CF32, CCR::DEINTERLEAVE);
+        }
+    });
+    const size_t numCustom = 200;
+    for (size_t i = 0; i < numCustom; i++)
+    {
+        SoapySDR::ConverterRegistry(SOAPY_SDR_CS16, "TEST_CUSTOM"+std::to_string(i), SoapySDR::ConverterRegistry::CUSTOM, &customCopy);
+        CCR(SOAPY_SDR_CF32, "TEST_CUSTOM"+std::to_string(i), CCR::INTERLEAVE, SoapySDR::ConverterRegistry::CUSTOM, CCR::getFunction(SOAPY_SDR_CF32, SOAPY_SDR_CF32, CCR::INTERLEAVE));
+    }
+    done = true;
+    for (auto &reader : readers) reader.join();
+
+    for (size_t i = 0; i < numCustom; i++)
+    {
+        if (SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS16, "TEST_CUSTOM"+std::to_string(i)) != &customCopy) return false;
+        if (CCR::listPriorities(SOAPY_SDR_CF32, "TEST_CUSTOM"+std::to_string(i), CCR::INTERLEAVE).size() != 1) return false;
+    }
+    return ok;
+}
+
+//the vectorized transposes must match the generic functions for every channel count,
+//and deinterleaving an interleaved buffer must restore the channels
+static bool checkChannelConverters(const std::string &format)
+{
+    typedef SoapySDR::ChannelConverterRegistry CCR;
+    const size_t elemSize = SoapySDR::formatToSize(format);
+    for (size_t numChans = 1; numChans <= 9; numChans++)
+    {
+        for (const size_t numElems : {0, 1, 3, 4, 5, 17, 1021})
+        {
+            for (const double scaler : {1.0, 0.5})
+            {
+                std::vector<std::vector<char>> chans(numChans, std::vector<char>(numElems*elemSize));
+                std::vector<const void *> chanPtrs;
+                for (auto &chan : chans)
+                {
+                    fillSource(format, chan, 0.9f);
+                    std::rotate(chan.begin(), chan.begin()+(chanPtrs.size()*elemSize)%(chan.size()+1), chan.end());
+                    chanPtrs.push_back(chan.data());
+                }
+
+                std::vector<char> out0(numChans*numElems*elemSize), out1(out0.size());
+                void *outPtr0 = out0.data(), *outPtr1 = out1.data();
+                CCR::getFunction(format, format, CCR::INTERLEAVE, SoapySDR::ConverterRegistry::GENERIC)(chanPtrs.data(), &outPtr0, numChans, numElems, scaler);
+                CCR::getFunction(format, format, CCR::INTERLEAVE)(chanPtrs.data(), &outPtr1, numChans, numElems, scaler);
+                if (out0 != out1)
+                {
+                    printf("FAIL: %s interleave differs, numChans=%d, numElems=%d\n", format.c_str(), int(numChans), int(numElems));
+                    return false;
+                }
+                if (scaler != 1.0) continue;
+
+                std::vector<std::vector<char>> back(numChans, std::vector<char>(numElems*elemSize));
+                std::vector<void *> backPtrs;
+                for (auto &chan : back) backPtrs.push_back(chan.data());
+                const void *inPtr = out1.data();
+                CCR::getFunction(format, format, CCR::DEINTERLEAVE)(&inPtr, backPtrs.data(), numChans, numElems, 1.0);
+                if (back != chans)
+                {
+                    printf("FAIL: %s deinterleave differs, numChans=%d, numElems=%d\n", format.c_str(), int(numChans), int(numElems));
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+//format changing transposes must match the generic functions in both directions
+static bool checkChannelFormatConverters(const std::string &source, const std::string &target)
+{
+    typedef SoapySDR::ChannelConverterRegistry CCR;
+    const size_t srcSize = SoapySDR::formatToSize(source);
+    const size_t dstSize = SoapySDR::formatToSize(target);
+    for (size_t numChans = 1; numChans <= 9; numChans++)
+    {
+        for (const size_t numElems : {0, 1, 7, 8, 9, 17, 1021})
+        {
+            for (const double scaler : {1.0, 0.5, 1.0/3})
+            {
+                //planar to interleaved
+                std::vector<std::vector<char>> chans(numChans, std::vector<char>(numElems*srcSize));
+                std::vector<const void *> chanPtrs;
+                for (auto &chan : chans)
+                {
+                    fillSource(source, chan, 0.9f);
+                    std::rotate(chan.begin(), chan.begin()+(chanPtrs.size()*srcSize)%(chan.size()+1), chan.end());
+                    chanPtrs.push_back(chan.data());
+                }
+                std::vector<char> out0(numChans*numElems*dstSize), out1(out0.size());
+                void *outPtr0 = out0.data(), *outPtr1 = out1.data();
+                CCR::getFunction(source, target, CCR::INTERLEAVE, SoapySDR::ConverterRegistry::GENERIC)(chanPtrs.data(), &outPtr0, numChans, numElems, scaler);
+                CCR::getFunction(source, target, CCR::INTERLEAVE)(chanPtrs.data(), &outPtr1, numChans, numElems, scaler);
+                if (out0 != out1)
+                {
+                    printf("FAIL: %s -> %s interleave differs, numChans=%d, numElems=%d\n", source.c_str(), target.c_str(), int(numChans), int(numElems));
+                    return false;
+                }
+
+                //interleaved to planar
+                std::vector<char> in(numChans*numElems*srcSize);
+                fillSource(source, in, 0.9f);
+                const void *inPtr = in.data();
+                std::vector<std::vector<char>> back0(numChans, std::vector<char>(numElems*dstSize)), back1(back0);
+                std::vector<void *> backPtrs0, backPtrs1;
+                for (size_t ch = 0; ch < numChans; ch++)
+                {
+                    backPtrs0.push_back(back0[ch].data());
+                    backPtrs1.push_back(back1[ch].data());
+                }
+                CCR::getFunction(source, target, CCR::DEINTERLEAVE, SoapySDR::ConverterRegistry::GENERIC)(&inPtr, backPtrs0.data(), numChans, numElems, scaler);
+                CCR::getFunction(source, target, CCR::DEINTERLEAVE)(&inPtr, backPtrs1.data(), numChans, numElems, scaler);
+                if (back0 != back1)
+                {
+                    printf("FAIL: %s -> %s deinterleave differs, numChans=%d, numElems=%d\n", source.c_str(), target.c_str(), int(numChans), int(numElems));
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+//format changing interleave matches the single channel converter per channel
+static bool checkChannelConversion(void)
+{
+    typedef SoapySDR::ChannelConverterRegistry CCR;
+    const size_t numChans = 3, numElems = 100;
+    std::vector<std::vector<char>> chans(numChans, std::vector<char>(numElems*4));
+    std::vector<const void *> chanPtrs;
+    for (auto &chan : chans)
+    {
+        fillSource(SOAPY_SDR_CS16, chan, 0.0f);
+        chan[0] = char(chanPtrs.size());
+        chanPtrs.push_back(chan.data());
+    }
+    std::vector<float> out(numChans*numElems*2);
+    void *outPtr = out.data();
+    CCR::getFunction(SOAPY_SDR_CS16, SOAPY_SDR_CF32, CCR::INTERLEAVE)(chanPtrs.data(), &outPtr, numChans, numElems, 0.25);
+
+    const auto single = SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC);
+    std::vector<float> expected(numElems*2);
+    for (size_t ch = 0; ch < numChans; ch++)
+    {
+        single(chans[ch].data(), expected.data(), numElems, 0.25);
+        for (size_t i = 0; i < numElems; i++)
+        {
+            if (out[(i*numChans+ch)*2+0] != expected[i*2+0] or out[(i*numChans+ch)*2+1] != expected[i*2+1]) return false;
+        }
+    }
+    return CCR::listTargetFormats(SOAPY_SDR_CS16, CCR::DEINTERLEAVE).size() == 8;
+}
+
+//saturating converters clip and round, and the vectorized kernels match the generic ones on hot signals
+static bool checkSaturating(const std::string &source, const std::string &target)
+{
+    typedef SoapySDR::ConverterRegistry CR;
+    const auto generic = CR::getSaturatingFunction(source, target, CR::GENERIC);
+    CR::ConverterFunction vectorized = nullptr;
+    try
+    {
+        vectorized = CR::getSaturatingFunction(source, target, CR::VECTORIZED);
+    }
+    catch (const std::exception &)
+    {
+        return true; //no kernel for the features of this host
+    }
+    const size_t srcSize = SoapySDR::formatToSize(source);
+    const size_t dstSize = SoapySDR::formatToSize(target);
+    for (const size_t numElems : {0, 1, 7, 16, 33, 1021})
+    {
+        for (const double scaler : {1.0, 0.5, 2.0, 1.0/3})
+        {
+            std::vector<char> src(numElems*srcSize);
+            std::vector<char> out0(numElems*dstSize), out1(numElems*dstSize);
+            fillSource(source, src, 1.5f);
+            generic(src.data(), out0.data(), numElems, scaler);
+            vectorized(src.data(), out1.data(), numElems, scaler);
+            if (out0 != out1)
+            {
+                printf("FAIL: saturating %s -> %s differs, numElems=%d, scaler=%f\n",
+                    source.c_str(), target.c_str(), int(numElems), scaler);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool checkSaturatingValues(void)
+{
+    const float in[] = {1.5f, -1.5f, 1.0f, -1.0f, 2.5f/32768, -2.5f/32768, 1.4f/32768, 1e10f};
+    const int16_t expected[] = {32767, -32768, 32767, -32768, 2, -2, 1, 32767};
+    int16_t out[8];
+    SoapySDR::ConverterRegistry::getSaturatingFunction(SOAPY_SDR_F32, SOAPY_SDR_S16)(in, out, 8, 1.0);
+    if (std::memcmp(out, expected, sizeof(out)) != 0) return false;
+
+    if (SoapySDR::F32toS32Sat(2.0f) != INT32_MAX or SoapySDR::F32toS32Sat(-2.0f) != INT32_MIN) return false;
+    if (SoapySDR::F64toU8Sat(1.5) != 255 or SoapySDR::F64toU8Sat(-1.5) != 0) return false;
+    return SoapySDRConverter_getSaturatingFunction(SOAPY_SDR_CS16, SOAPY_SDR_CF32) == nullptr;
+}
+
+//big-endian formats hold the most significant byte first
+static bool checkBigEndian(void)
+{
+    const int16_t native[2] = {0x0102, -2};
+    const uint8_t wire[4] = {0x01, 0x02, 0xff, 0xfe};
+    uint8_t out[4];
+    SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS16, SOAPY_SDR_CS16_BE)(native, out, 1, 1.0);
+    if (std::memcmp(out, wire, sizeof(wire)) != 0) return false;
+
+    float cf32[2];
+    SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS16_BE, SOAPY_SDR_CF32)(wire, cf32, 1, 1.0);
+    if (cf32[0] != SoapySDR::S16toF32(0x0102) or cf32[1] != SoapySDR::S16toF32(-2)) return false;
+
+    //conversions to other native formats need no intermediate pass
+    return SoapySDR::ConverterRegistry::findPath(SOAPY_SDR_CS16_BE, SOAPY_SDR_CU8).size() == 2;
+}
+
+//half precision values round to nearest even and survive a round trip through CF32
+static bool checkHalf(void)
+{
+    if (SoapySDR::F32toF16(1.0f) != 0x3c00 or SoapySDR::F32toF16(-2.0f) != 0xc000) return false;
+    if (SoapySDR::F32toF16(65520.0f) != 0x7c00 or SoapySDR::F16toF32(0x0001) != 5.9604644775390625e-8f) return false;
+    if (SoapySDR::F32toF16(1.0f + 1.0f/4096) != 0x3c00) return false;
+
+    const size_t numElems = 1021;
+    std::vector<uint16_t> half(numElems*2), back(numElems*2);
+    for (size_t i = 0; i < half.size(); i++) half[i] = uint16_t(i*37) & 0x7bff;
+    std::vector<float> cf32(numElems*2);
+    SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CF16, SOAPY_SDR_CF32)(half.data(), cf32.data(), numElems, 1.0);
+    SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CF32, SOAPY_SDR_CF16)(cf32.data(), back.data(), numElems, 1.0);
+    if (half != back) return false;
+
+    //the integer kernels need AVX2 besides F16C, the float kernels only AVX
+    typedef SoapySDR::ConverterRegistry CR;
+    const int features = CR::getCPUFeatures();
+    if ((features & CR::CPU_F16C) != 0 and (features & (CR::CPU_AVX2 | CR::CPU_AVX512F)) == 0)
+    {
+        if (CR::listPriorities(SOAPY_SDR_CS16, SOAPY_SDR_CF16).back() != CR::GENERIC) return false;
+        if (CR::listPriorities(SOAPY_SDR_F16, SOAPY_SDR_S16).back() != CR::GENERIC) return false;
+        if (CR::getRequiredCPUFeatures(SOAPY_SDR_CF32, SOAPY_SDR_CF16, CR::VECTORIZED) != (CR::CPU_AVX | CR::CPU_F16C)) return false;
+    }
+    for (const auto &pair : {std::make_pair(SOAPY_SDR_CS16, SOAPY_SDR_CF16), std::make_pair(SOAPY_SDR_CF16, SOAPY_SDR_CS16)})
+    {
+        if (CR::listPriorities(pair.first, pair.second).back() != CR::VECTORIZED) continue;
+        const int required = CR::getRequiredCPUFeatures(pair.first, pair.second, CR::VECTORIZED);
+        if ((required & CR::CPU_F16C) != 0 and (required & CR::CPU_AVX2) == 0) return false;
+    }
+
+    //other formats convert through CF32 or CS16
+    return SoapySDR::ConverterRegistry::findPath(SOAPY_SDR_CU8, SOAPY_SDR_CF16).size() == 3;
+}
+
+//the lookup tables serve the 8-bit complex formats only when no SIMD kernel can,
+//and the table of a thread follows every scaler change
+static bool checkTableConverters(void)
+{
+    typedef SoapySDR::ConverterRegistry CR;
+    const bool simd = (CR::getCPUFeatures() & CR::CPU_SSE2) != 0;
+    for (const auto &source : {SOAPY_SDR_CU8, SOAPY_SDR_CS8})
+    {
+        const int required = CR::getRequiredCPUFeatures(source, SOAPY_SDR_CF32, CR::VECTORIZED);
+        if (simd != (required != 0)) return false;
+
+        const size_t numElems = 1021;
+        std::vector<char> src(numElems*2);
+        fillSource(source, src, 1.0f);
+        std::vector<float> out0(numElems*2), out1(numElems*2);
+        for (const double scaler : {1.0, 0.25, 1.0, 3.0, 3.0})
+        {
+            CR::getFunction(source, SOAPY_SDR_CF32, CR::GENERIC)(src.data(), out0.data(), numElems, scaler);
+            CR::getFunction(source, SOAPY_SDR_CF32, CR::VECTORIZED)(src.data(), out1.data(), numElems, scaler);
+            if (out0 != out1) return false;
+        }
+    }
+    return true;
+}
+
+//mixing must match a double precision frequency shift, with the phase continuous across calls
+static bool checkMixer(const std::string &source, const std::string &target, const double tolerance)
+{
+    const double frequency = -0.1234567;
+    const double scaler = 0.5; //complex magnitudes stay under full scale
+    SoapySDR::ConverterMixer mixer(source, target, frequency, scaler);
+    if (not mixer.isValid()) return false;
+
+    const size_t numElems = 3001;
+    std::vector<char> src(numElems*SoapySDR::formatToSize(source));
+    fillSource(source, src, 0.9f);
+    std::vector<float> expected(numElems*2);
+    SoapySDR::ConverterPlan(source, SOAPY_SDR_CF32, scaler).execute(src.data(), expected.data(), numElems);
+    for (size_t i = 0; i < numElems; i++)
+    {
+        const double angle = 2*3.14159265358979323846*frequency*i;
+        const double re = expected[2*i+0], im = expected[2*i+1];
+        expected[2*i+0] = float(re*std::cos(angle) - im*std::sin(angle));
+        expected[2*i+1] = float(re*std::sin(angle) + im*std::cos(angle));
+    }
+
+    //uneven calls that split the vector kernels and the chunks
+    std::vector<char> out(numElems*SoapySDR::formatToSize(target));
+    const size_t srcSize = SoapySDR::formatToSize(source), dstSize = SoapySDR::formatToSize(target);
+    size_t offset = 0;
+    for (const size_t n : {size_t(1), size_t(1000), size_t(3), size_t(1997)})
+    {
+        mixer.execute(src.data()+offset*srcSize, out.data()+offset*dstSize, n);
+        offset += n;
+    }
+    const double phase = frequency*numElems - std::floor(frequency*numElems);
+    if (std::abs(mixer.getPhase() - phase) > 1e-9) return false;
+
+    std::vector<float> actual(numElems*2);
+    SoapySDR::ConverterPlan(target, SOAPY_SDR_CF32).execute(out.data(), actual.data(), numElems);
+    for (size_t i = 0; i < numElems*2; i++)
+    {
+        if (std::abs(actual[i] - expected[i]) > tolerance)
+        {
+            printf("FAIL: %s -> %s mixer sample %d is %f, expected %f\n",
+                source.c_str(), target.c_str(), int(i/2), actual[i], expected[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+//statistics accumulated during conversion must match a separate pass over the output
+static bool checkStats(const std::string &source, const std::string &target)
+{
+    SoapySDR::ConverterPlan plan(source, target);
+    const size_t numElems = 5000;
+    std::vector<char> src(numElems*plan.getSourceSize());
+    fillSource(source, src, 1.2f);
+    std::vector<char> out(numElems*plan.getTargetSize());
+    SoapySDR::ConverterStats stats;
+    plan.execute(src.data(), out.data(), numElems/2, stats);
+    plan.execute(src.data()+numElems/2*plan.getSourceSize(), out.data()+numElems/2*plan.getTargetSize(), numElems-numElems/2, stats);
+    if (stats.numElems != numElems) return false;
+
+    //the expected values from the CF32 side, the input for a CF32 source and the output otherwise
+    std::vector<float> cf32(numElems*2);
+    if (source == SOAPY_SDR_CF32) std::memcpy(cf32.data(), src.data(), src.size());
+    else SoapySDR::ConverterPlan(target, SOAPY_SDR_CF32).execute(out.data(), cf32.data(), numElems);
+    const std::string integer = (target == SOAPY_SDR_CF32)?source:target;
+    const double fullScale = (integer == SOAPY_SDR_CS16)?32768.0:128.0;
+    double peak = 0.0, sumI = 0.0, sumQ = 0.0, sumPower = 0.0;
+    size_t clipped = 0;
+    for (size_t i = 0; i < numElems; i++)
+    {
+        const double re = cf32[2*i+0], im = cf32[2*i+1];
+        const double mag = std::max(std::abs(re), std::abs(im));
+        peak = std::max(peak, mag);
+        sumI += re;
+        sumQ += im;
+        sumPower += re*re + im*im;
+        if (mag >= float((fullScale-1)/fullScale)) clipped++;
+    }
+    printf("  %s -> %s: rms=%f, peak=%f, clipped=%d\n", source.c_str(), target.c_str(), stats.rms(), stats.peak, int(stats.numClipped));
+    if (stats.numClipped != clipped or stats.peak != peak) return false;
+    if (std::abs(stats.sumPower - sumPower) > 1e-4*sumPower) return false;
+    if (std::abs(stats.meanI() - sumI/numElems) > 1e-5 or std::abs(stats.meanQ() - sumQ/numElems) > 1e-5) return false;
+
+    //the measurement is set up by the first call, on copies, on concurrent callers,
+    //and again on a plan that was measured before it was assigned
+    SoapySDR::ConverterPlan copy(plan), assigned(SOAPY_SDR_CF32, SOAPY_SDR_CS8);
+    SoapySDR::ConverterStats copyStats[2], assignedStats;
+    std::vector<char> out0(out.size()), out1(out.size()), other(numElems*2);
+    assigned.execute(cf32.data(), other.data(), numElems, assignedStats);
+    assigned = plan;
+    assignedStats.reset();
+    std::thread worker([&](){copy.execute(src.data(), out0.data(), numElems, copyStats[0]);});
+    copy.execute(src.data(), out1.data(), numElems, copyStats[1]);
+    worker.join();
+    assigned.execute(src.data(), out0.data(), numElems, assignedStats);
+    for (const auto &result : {copyStats[0], copyStats[1], assignedStats})
+    {
+        if (result.numClipped != clipped or result.peak != peak or result.numElems != numElems) return false;
+    }
+    return true;
+}
+
+//the C API batch, statistics, and mixer calls must match the C++ classes
+static bool checkConverterCAPI(void)
+{
+    const size_t numElems = 1000, numBuffs = 3;
+    auto *cplan = SoapySDRConverterPlan_make(SOAPY_SDR_CS16, SOAPY_SDR_CF32, 0.5);
+    if (cplan == nullptr) return false;
+    if (std::string(SoapySDRConverterPlan_getSourceFormat(cplan)) != SOAPY_SDR_CS16) return false;
+    if (std::string(SoapySDRConverterPlan_getTargetFormat(cplan)) != SOAPY_SDR_CF32) return false;
+    if (SoapySDRConverterPlan_getScaler(cplan) != 0.5) return false;
+
+    const SoapySDR::ConverterPlan plan(SOAPY_SDR_CS16, SOAPY_SDR_CF32, 0.5);
+    std::vector<std::vector<char>> src(numBuffs), out(numBuffs);
+    std::vector<const void *> srcBuffs;
+    std::vector<void *> dstBuffs;
+    for (size_t i = 0; i < numBuffs; i++)
+    {
+        src[i].resize(numElems*4);
+        out[i].resize(numElems*8);
+        fillSource(SOAPY_SDR_CS16, src[i], 0.5f+0.25f*i);
+        srcBuffs.push_back(src[i].data());
+        dstBuffs.push_back(out[i].data());
+    }
+    SoapySDRConverterPlan_executeBatch(cplan, srcBuffs.data(), dstBuffs.data(), numBuffs, numElems);
+    std::vector<char> expected(numElems*8);
+    for (size_t i = 0; i < numBuffs; i++)
+    {
+        plan.execute(src[i].data(), expected.data(), numElems);
+        if (out[i] != expected) return false;
+    }
+
+    SoapySDRConverterStats cstats;
+    std::memset(&cstats, 0, sizeof(cstats));
+    SoapySDR::ConverterStats stats;
+    for (size_t i = 0; i < numBuffs; i++)
+    {
+        if (SoapySDRConverterPlan_executeWithStats(cplan, src[i].data(), out[i].data(), numElems, &cstats) != 0) return false;
+        plan.execute(src[i].data(), expected.data(), numElems, stats);
+    }
+    SoapySDRConverterPlan_unmake(cplan);
+    if (cstats.numElems != stats.numElems or cstats.numClipped != stats.numClipped) return false;
+    if (cstats.peak != stats.peak or cstats.sumPower != stats.sumPower) return false;
+
+    SoapySDR::ConverterMixer mixer(SOAPY_SDR_CS16, SOAPY_SDR_CF32, 0.125);
+    auto *cmixer = SoapySDRConverterMixer_make(SOAPY_SDR_CS16, SOAPY_SDR_CF32, 0.125, 1.0);
+    if (cmixer == nullptr) return false;
+    SoapySDRConverterMixer_setPhase(cmixer, 0.25);
+    mixer.setPhase(0.25);
+    SoapySDRConverterMixer_execute(cmixer, src[0].data(), out[0].data(), numElems);
+    mixer.execute(src[0].data(), expected.data(), numElems);
+    const bool same = out[0] == expected and SoapySDRConverterMixer_getPhase(cmixer) == mixer.getPhase();
+    SoapySDRConverterMixer_unmake(cmixer);
+    if (not same) return false;
+    return SoapySDRConverterMixer_make(SOAPY_SDR_F32, SOAPY_SDR_CF32, 0.1, 1.0) == nullptr;
+}
+
+//converting in place must give the same output as converting into a separate buffer
+static bool checkInPlace(void)
+{
+    typedef SoapySDR::ConverterRegistry CR;
+    if (not CR::supportsInPlace(SOAPY_SDR_CF32, SOAPY_SDR_CS16)) return false;
+    if (not CR::supportsInPlace(SOAPY_SDR_CS16, SOAPY_SDR_CU16)) return false;
+    if (CR::supportsInPlace(SOAPY_SDR_CS16, SOAPY_SDR_CF32)) return false;
+
+    size_t numChecked = 0;
+    for (const auto &source : CR::listAvailableSourceFormats())
+    {
+        for (const auto &target : CR::listTargetFormats(source))
+        {
+            for (const auto priority : CR::listPriorities(source, target))
+            {
+                if (not CR::supportsInPlace(source, target, priority)) continue;
+                const auto function = CR::getFunction(source, target, priority);
+                const size_t numElems = 1021;
+                std::vector<char> buff(numElems*SoapySDR::formatToSize(source));
+                fillSource(source, buff, 0.9f);
+                std::vector<char> expected(numElems*SoapySDR::formatToSize(target));
+                function(buff.data(), expected.data(), numElems, 1.0);
+                function(buff.data(), buff.data(), numElems, 1.0);
+                if (std::memcmp(buff.data(), expected.data(), expected.size()) != 0)
+                {
+                    printf("FAIL: %s -> %s priority %d differs in place\n", source.c_str(), target.c_str(), int(priority));
+                    return false;
+                }
+                numChecked++;
+            }
+        }
+    }
+    printf("  checked %d in-place converters\n", int(numChecked));
+
+    for (const auto &target : {SOAPY_SDR_CS16, SOAPY_SDR_CU8, SOAPY_SDR_CS16_BE})
+    {
+        const auto function = CR::getSaturatingFunction(SOAPY_SDR_CF32, target);
+        const size_t numElems = 1021;
+        std::vector<char> buff(numElems*SoapySDR::formatToSize(SOAPY_SDR_CF32));
+        fillSource(SOAPY_SDR_CF32, buff, 1.5f);
+        std::vector<char> expected(numElems*SoapySDR::formatToSize(target));
+        function(buff.data(), expected.data(), numElems, 1.0);
+        function(buff.data(), buff.data(), numElems, 1.0);
+        if (std::memcmp(buff.data(), expected.data(), expected.size()) != 0) return false;
+    }
+
+    //a narrowing chain through scratch buffers
+    SoapySDR::ConverterPlan plan(SOAPY_SDR_CF32, SOAPY_SDR_CS4);
+    if (not plan.supportsInPlace()) return false;
+    const size_t numElems = 1 << 18;
+    std::vector<char> buff(numElems*plan.getSourceSize());
+    fillSource(SOAPY_SDR_CF32, buff, 0.9f);
+    std::vector<char> expected(numElems*plan.getTargetSize());
+    plan.execute(buff.data(), expected.data(), numElems);
+    plan.executeParallel(buff.data(), buff.data(), numElems, 4);
+    return std::memcmp(buff.data(), expected.data(), expected.size()) == 0;
+}
+
+int main(void)
+{
+    printf("Host CPU features: 0x%x\n", SoapySDR::ConverterRegistry::getCPUFeatures());
+
+    printf("Check generic converter matrix:\n");
+    if (not checkGenericMatrix())
+    {
+        printf("FAIL: generic converter matrix\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("Check converter plans:\n");
+    if (not checkPlan())
+    {
+        printf("FAIL: converter plan\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("Check selected priorities:\n");
+    if (not checkSelectedPriorities())
+    {
+        printf("FAIL: selected priorities\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("Check multi-hop conversion:\n");
+    if (not checkChain(SOAPY_SDR_CU12, SOAPY_SDR_CF64, 2)) return EXIT_FAILURE;
+    if (not checkChain(SOAPY_SDR_CS4, SOAPY_SDR_CU12, 2)) return EXIT_FAILURE;
+    if (not SoapySDR::ConverterRegistry::findPath(SOAPY_SDR_CS16, "NOT_A_FORMAT").empty()) return EXIT_FAILURE;
+
+    printf("Check parallel execution:\n");
+    if (not checkParallel(SOAPY_SDR_CS16, SOAPY_SDR_CF32)) return EXIT_FAILURE;
+    if (not checkParallel(SOAPY_SDR_CU8, SOAPY_SDR_CF32)) return EXIT_FAILURE;
+    if (not checkParallel(SOAPY_SDR_CF32, SOAPY_SDR_CS12)) return EXIT_FAILURE;
+
+    printf("Check feature ranking:\n");
+    if (not checkFeatureRanking())
+    {
+        printf("FAIL: feature ranking\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("Check concurrent registration:\n");
+    if (not checkConcurrentRegistration())
+    {
+        printf("FAIL: concurrent registration\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("Check vectorized converters against generic:\n");
+    size_t numChecked = 0;
+    for (const auto &source : SoapySDR::ConverterRegistry::listAvailableSourceFormats())
+    {
+        for (const auto &target : SoapySDR::ConverterRegistry::listTargetFormats(source))
+        {
+            const auto priorities = SoapySDR::ConverterRegistry::listPriorities(source, target);
+            if (std::find(priorities.begin(), priorities.end(), SoapySDR::ConverterRegistry::VECTORIZED) == priorities.end()) continue;
+            printf("  %s -> %s ... ", source.c_str(), target.c_str());
+            for (const double scaler : {1.0, 0.5, 2.0, 0.75, 1.0/3})
+            {
+                if (not checkBitExact(source, target, scaler)) return EXIT_FAILURE;
+            }
+            printf("PASS\n");
+            numChecked++;
+        }
+    }
+    printf("Checked %d vectorized converters\n", int(numChecked));
+
+    printf("Check table converters:\n");
+    if (not checkTableConverters())
+    {
+        printf("FAIL: table converters\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("Check packed format round trips:\n");
+    for (const auto &packed : {SOAPY_SDR_CS12, SOAPY_SDR_CU12})
+    {
+        printf("  CS16 -> %s -> CS16 ... ", packed);
+        if (not checkPackedRoundTrip(packed, 12)) return EXIT_FAILURE;
+        printf("PASS\n");
+    }
+    for (const auto &packed : {SOAPY_SDR_CS4, SOAPY_SDR_CU4})
+    {
+        printf("  CS16 -> %s -> CS16 ... ", packed);
+        if (not checkPackedRoundTrip(packed, 4)) return EXIT_FAILURE;
+        printf("PASS\n");
+    }
+
+    printf("Check saturating converters:\n");
+    for (const auto &target : {SOAPY_SDR_CS16, SOAPY_SDR_CU16, SOAPY_SDR_CS8, SOAPY_SDR_CU8})
+    {
+        printf("  CF32 -> %s ... ", target);
+        if (not checkSaturating(SOAPY_SDR_CF32, target)) return EXIT_FAILURE;
+        printf("PASS\n");
+    }
+    printf("  CF32 -> %s ... ", SOAPY_SDR_CS16_BE);
+    if (not checkSaturating(SOAPY_SDR_CF32, SOAPY_SDR_CS16_BE)) return EXIT_FAILURE;
+    printf("PASS\n");
+    if (not checkSaturatingValues())
+    {
+        printf("FAIL: saturating values\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("Check big-endian formats:\n");
+    if (not checkBigEndian())
+    {
+        printf("FAIL: big-endian formats\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("Check half precision formats:\n");
+    if (not checkHalf())
+    {
+        printf("FAIL: half precision formats\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("Check in-place conversion:\n");
+    if (not checkInPlace())
+    {
+        printf("FAIL: in-place conversion\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("Check conversion statistics:\n");
+    if (not checkStats(SOAPY_SDR_CS16, SOAPY_SDR_CF32)) return EXIT_FAILURE;
+    if (not checkStats(SOAPY_SDR_CU8, SOAPY_SDR_CF32)) return EXIT_FAILURE;
+    if (not checkStats(SOAPY_SDR_CS16, SOAPY_SDR_CS8)) return EXIT_FAILURE;
+    if (not checkStats(SOAPY_SDR_CF32, SOAPY_SDR_CS16)) return EXIT_FAILURE;
+
+    printf("Check converter C API:\n");
+    if (not checkConverterCAPI())
+    {
+        printf("FAIL: converter C API\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("Check converter mixers:\n");
+    if (not checkMixer(SOAPY_SDR_CS16, SOAPY_SDR_CF32, 1e-5)) return EXIT_FAILURE;
+    if (not checkMixer(SOAPY_SDR_CF32, SOAPY_SDR_CF32, 1e-5)) return EXIT_FAILURE;
+    if (not checkMixer(SOAPY_SDR_CU8, SOAPY_SDR_CF32, 1e-5)) return EXIT_FAILURE;
+    if (not checkMixer(SOAPY_SDR_CS16, SOAPY_SDR_CS16, 1.0/16384)) return EXIT_FAILURE;
+
+    printf("Check channel converters:\n");
+    for (const auto &format : {SOAPY_SDR_CS16, SOAPY_SDR_CF32, SOAPY_SDR_F32, SOAPY_SDR_CS8, SOAPY_SDR_F64})
+    {
+        printf("  %s ... ", format);
+        if (not checkChannelConverters(format)) return EXIT_FAILURE;
+        printf("PASS\n");
+    }
+    for (const auto &format : {SOAPY_SDR_CS16, SOAPY_SDR_CS8})
+    {
+        printf("  %s <-> %s ... ", format, SOAPY_SDR_CF32);
+        if (not checkChannelFormatConverters(format, SOAPY_SDR_CF32)) return EXIT_FAILURE;
+        if (not checkChannelFormatConverters(SOAPY_SDR_CF32, format)) return EXIT_FAILURE;
+        printf("PASS\n");
+    }
+    if (not checkChannelConversion())
+    {
+        printf("FAIL: channel conversion\n");
+        return EXIT_FAILURE;
+    }
+
+    //tuning writes the cache, so only in the autotune run with its own cache directory
+    const char *autotuneEnv = std::getenv("SOAPY_SDR_CONVERTER_AUTOTUNE");
+    if (autotuneEnv != nullptr and std::string(autotuneEnv) == "1")
+    {
+        printf("Check tuned priorities and module converters:\n");
+        if (not checkTunedPriority())
+        {
+            printf("FAIL: tuned priority\n");
+            return EXIT_FAILURE;
+        }
+    }
+
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,259 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Device.h>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Errors.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <cstdint>
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <thread>
+#include <chrono>
+
+/***********************************************************************
+ * A CS16 device without direct access that receives a counting
+ * sequence, and transmits up to 60 elements per write
+ **********************************************************************/
+struct TxRecord
+{
+    size_t numElems;
+    int flags;
+    long long timeNs;
+};
+
+class MockDevice : public SoapySDR::Device
+{
+public:
+    MockDevice(const size_t numNative = 0):
+        numNative(numNative),
+        rxCount(0),
+        badMTU(false),
+        numClosed(0),
+        lastTimeoutUs(0)
+    {
+        return;
+    }
+
+    SoapySDR::Stream *setupStream(const int, const std::string &, const std::vector<size_t> &, const SoapySDR::Kwargs &)
+    {
+        return reinterpret_cast<SoapySDR::Stream *>(this);
+    }
+
+    void closeStream(SoapySDR::Stream *)
+    {
+        numClosed++;
+    }
+
+    size_t getStreamMTU(SoapySDR::Stream *) const
+    {
+        if (badMTU) throw std::runtime_error("no MTU");
+        return 100;
+    }
+
+    int readStream(SoapySDR::Stream *, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+    {
+        lastTimeoutUs = timeoutUs;
+        for (size_t ch = 0; ch < 2; ch++)
+        {
+            int16_t *buff = (int16_t *)buffs[ch];
+            for (size_t i = 0; i < numElems*2; i++) buff[i] = int16_t(rxCount*2 + i + ch*1000);
+        }
+        flags = SOAPY_SDR_HAS_TIME;
+        timeNs = (long long)rxCount;
+        rxCount += numElems;
+        return int(numElems);
+    }
+
+    int writeStream(SoapySDR::Stream *, const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long)
+    {
+        const size_t n = std::min<size_t>(numElems, 60);
+        if (n < numElems) flags &= ~SOAPY_SDR_END_BURST;
+        const int16_t *buff = (const int16_t *)buffs[0];
+        samples.insert(samples.end(), buff, buff+n*2);
+        TxRecord record = {n, flags, timeNs};
+        records.push_back(record);
+        return int(n);
+    }
+
+    size_t getNumDirectAccessBuffers(SoapySDR::Stream *stream)
+    {
+        if (numNative != 0) return numNative;
+        return SoapySDR::Device::getNumDirectAccessBuffers(stream);
+    }
+
+    const size_t numNative;
+    size_t rxCount;
+    bool badMTU;
+    size_t numClosed;
+    long lastTimeoutUs;
+    std::vector<int16_t> samples;
+    std::vector<TxRecord> records;
+};
+
+static bool checkReceive(void)
+{
+    MockDevice mock;
+    SoapySDRDevice *device = reinterpret_cast<SoapySDRDevice *>(static_cast<SoapySDR::Device *>(&mock));
+    const size_t channels[2] = {0, 1};
+    SoapySDRStream *stream = SoapySDRDevice_setupStream(device, SOAPY_SDR_RX, SOAPY_SDR_CS16, channels, 2, nullptr);
+    if (stream == nullptr) return false;
+    if (SoapySDRDevice_getNumDirectAccessBuffers(device, stream) != 4) return false;
+
+    //every buffer can be held at once, and the pool then times out
+    size_t handles[4];
+    for (size_t i = 0; i < 4; i++)
+    {
+        const void *buffs[2] = {};
+        int flags(0);
+        long long timeNs(0);
+        if (SoapySDRDevice_acquireReadBuffer(device, stream, &handles[i], buffs, &flags, &timeNs, 1000) != 100) return false;
+        if (flags != SOAPY_SDR_HAS_TIME or timeNs != (long long)(i*100)) return false;
+        for (size_t ch = 0; ch < 2; ch++)
+        {
+            if (uintptr_t(buffs[ch]) % 64 != 0) return false;
+            const int16_t *samples = (const int16_t *)buffs[ch];
+            if (samples[0] != int16_t(i*200 + ch*1000) or samples[199] != int16_t(i*200 + 199 + ch*1000)) return false;
+        }
+
+        void *addrs[2] = {};
+        if (SoapySDRDevice_getDirectAccessBufferAddrs(device, stream, handles[i], addrs) != 0) return false;
+        if (addrs[0] != buffs[0] or addrs[1] != buffs[1]) return false;
+    }
+    {
+        size_t handle(0);
+        const void *buffs[2] = {};
+        int flags(0);
+        long long timeNs(0);
+        if (SoapySDRDevice_acquireReadBuffer(device, stream, &handle, buffs, &flags, &timeNs, 1000) != SOAPY_SDR_TIMEOUT) return false;
+        SoapySDRDevice_releaseReadBuffer(device, stream, handles[2]);
+        if (SoapySDRDevice_acquireReadBuffer(device, stream, &handle, buffs, &flags, &timeNs, 1000) != 100) return false;
+        if (handle != handles[2]) return false;
+
+        //receive buffers are not available for transmit
+        void *writeBuffs[2] = {};
+        if (SoapySDRDevice_acquireWriteBuffer(device, stream, &handle, writeBuffs, 1000) != SOAPY_SDR_NOT_SUPPORTED) return false;
+    }
+
+    if (SoapySDRDevice_closeStream(device, stream) != 0) return false;
+    return SoapySDRDevice_getNumDirectAccessBuffers(device, stream) == 0;
+}
+
+static bool checkTransmit(void)
+{
+    MockDevice device;
+    SoapySDR::Stream *stream = device.setupStream(SOAPY_SDR_TX, SOAPY_SDR_CS16, {0}, {});
+    if (device.getNumDirectAccessBuffers(stream) != 0) return false;
+    auto emulation = device.enableDirectAccessEmulation(stream, SOAPY_SDR_TX, SOAPY_SDR_CS16, 1, 2);
+    if (device.getNumDirectAccessBuffers(stream) != 2) return false;
+
+    size_t handle(0);
+    void *buffs[1] = {};
+    if (device.acquireWriteBuffer(stream, handle, buffs) != 100) return false;
+    int16_t *samples = (int16_t *)buffs[0];
+    for (size_t i = 0; i < 100*2; i++) samples[i] = int16_t(i);
+
+    //the driver takes the buffer in two calls, the time goes with the first
+    int flags(SOAPY_SDR_HAS_TIME | SOAPY_SDR_END_BURST);
+    device.releaseWriteBuffer(stream, handle, 100, flags, 1234);
+    if (flags != SOAPY_SDR_END_BURST) return false;
+    if (device.records.size() != 2) return false;
+    if (device.records[0].numElems != 60 or device.records[0].flags != SOAPY_SDR_HAS_TIME) return false;
+    if (device.records[1].numElems != 40 or device.records[1].flags != SOAPY_SDR_END_BURST) return false;
+    for (size_t i = 0; i < 100*2; i++)
+    {
+        if (device.samples[i] != int16_t(i)) return false;
+    }
+
+    //an empty buffer still ends the burst
+    if (device.acquireWriteBuffer(stream, handle, buffs) != 100) return false;
+    flags = SOAPY_SDR_END_BURST;
+    device.releaseWriteBuffer(stream, handle, 0, flags);
+    if (device.records.size() != 3 or device.records[2].flags != SOAPY_SDR_END_BURST) return false;
+
+    //a later stream at the same address does not inherit the buffers
+    emulation.reset();
+    return device.acquireWriteBuffer(stream, handle, buffs) == SOAPY_SDR_NOT_SUPPORTED;
+}
+
+static bool checkReadTimeout(void)
+{
+    MockDevice device;
+    SoapySDR::Stream *stream = device.setupStream(SOAPY_SDR_RX, SOAPY_SDR_CS16, {0, 1}, {});
+    auto emulation = device.enableDirectAccessEmulation(stream, SOAPY_SDR_RX, SOAPY_SDR_CS16, 2, 1);
+
+    size_t held(0), handle(0);
+    const void *buffs[2] = {};
+    int flags(0);
+    long long timeNs(0);
+    if (device.acquireReadBuffer(stream, held, buffs, flags, timeNs) != 100) return false;
+
+    //the time spent waiting for a buffer comes out of the read timeout
+    std::thread releaser([&]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        device.releaseReadBuffer(stream, held);
+    });
+    const int ret = device.acquireReadBuffer(stream, handle, buffs, flags, timeNs, 200000);
+    releaser.join();
+    printf("  readStream() timeout %ld us\n", device.lastTimeoutUs);
+    return ret == 100 and device.lastTimeoutUs <= 150000;
+}
+
+static bool checkLazySetup(void)
+{
+    //the pool is only set up by the first direct access call
+    MockDevice mock;
+    mock.badMTU = true;
+    SoapySDRDevice *device = reinterpret_cast<SoapySDRDevice *>(static_cast<SoapySDR::Device *>(&mock));
+    SoapySDRStream *stream = SoapySDRDevice_setupStream(device, SOAPY_SDR_RX, SOAPY_SDR_CS16, nullptr, 0, nullptr);
+    if (stream == nullptr) return false;
+
+    //so the failure is reported there, and the next call tries again
+    if (SoapySDRDevice_getNumDirectAccessBuffers(device, stream) != size_t(-1)) return false;
+    mock.badMTU = false;
+    if (SoapySDRDevice_getNumDirectAccessBuffers(device, stream) != 4) return false;
+    return SoapySDRDevice_closeStream(device, stream) == 0 and mock.numClosed == 1;
+}
+
+static bool checkNotEmulated(void)
+{
+    //native direct access is left to the driver
+    MockDevice native(2);
+    SoapySDRDevice *device = reinterpret_cast<SoapySDRDevice *>(static_cast<SoapySDR::Device *>(&native));
+    SoapySDRStream *stream = SoapySDRDevice_setupStream(device, SOAPY_SDR_RX, SOAPY_SDR_CS16, nullptr, 0, nullptr);
+    size_t handle(0);
+    const void *buffs[1] = {};
+    int flags(0);
+    long long timeNs(0);
+    if (SoapySDRDevice_acquireReadBuffer(device, stream, &handle, buffs, &flags, &timeNs, 1000) != SOAPY_SDR_NOT_SUPPORTED) return false;
+    SoapySDRDevice_closeStream(device, stream);
+
+    //so are formats without a known element size
+    MockDevice custom;
+    device = reinterpret_cast<SoapySDRDevice *>(static_cast<SoapySDR::Device *>(&custom));
+    stream = SoapySDRDevice_setupStream(device, SOAPY_SDR_RX, "CUSTOM", nullptr, 0, nullptr);
+    if (stream == nullptr) return false;
+    const bool emulated = SoapySDRDevice_getNumDirectAccessBuffers(device, stream) != 0;
+    SoapySDRDevice_closeStream(device, stream);
+    return not emulated;
+}
+
+int main(void)
+{
+    printf("Check emulated receive buffers:\n");
+    if (not checkReceive()) return EXIT_FAILURE;
+    printf("Check emulated transmit buffers:\n");
+    if (not checkTransmit()) return EXIT_FAILURE;
+    printf("Check the read timeout:\n");
+    if (not checkReadTimeout()) return EXIT_FAILURE;
+    printf("Check lazy emulation setup:\n");
+    if (not checkLazySetup()) return EXIT_FAILURE;
+    printf("Check native and unknown formats:\n");
+    if (not checkNotEmulated()) return EXIT_FAILURE;
+
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,273 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/StreamAdapter.hpp>
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include <string>
+#include <stdexcept>
+
+/***********************************************************************
+ * A CS16 device with a 12-bit full scale that receives a counting
+ * sequence and records transmitted samples, with optional direct access
+ **********************************************************************/
+class MockDevice : public SoapySDR::Device
+{
+public:
+    MockDevice(const bool direct, const size_t mtu):
+        direct(direct),
+        mtu(mtu),
+        rxCount(0),
+        numAcquired(0),
+        numReleased(0),
+        directBuff(mtu*2),
+        numStreams(0),
+        failMTU(false)
+    {
+        return;
+    }
+
+    std::vector<std::string> getStreamFormats(const int, const size_t) const
+    {
+        return {SOAPY_SDR_CS16, "TEST_DRIVER_FORMAT"};
+    }
+
+    std::string getNativeStreamFormat(const int, const size_t, double &fullScale) const
+    {
+        fullScale = 2048;
+        return SOAPY_SDR_CS16;
+    }
+
+    SoapySDR::Stream *setupStream(const int, const std::string &format, const std::vector<size_t> &, const SoapySDR::Kwargs &)
+    {
+        setupFormat = format;
+        numStreams++;
+        return reinterpret_cast<SoapySDR::Stream *>(this);
+    }
+
+    void closeStream(SoapySDR::Stream *)
+    {
+        numStreams--;
+    }
+
+    size_t getStreamMTU(SoapySDR::Stream *) const
+    {
+        if (failMTU) throw std::runtime_error("getStreamMTU() failed");
+        return mtu;
+    }
+
+    double getSampleRate(const int, const size_t) const
+    {
+        return 1e6;
+    }
+
+    int readStream(SoapySDR::Stream *, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long)
+    {
+        const size_t n = std::min(numElems, mtu);
+        fill((int16_t *)buffs[0], n, flags, timeNs);
+        return int(n);
+    }
+
+    int writeStream(SoapySDR::Stream *, const void * const *buffs, const size_t numElems, int &flags, const long long, const long)
+    {
+        const size_t n = std::min(numElems, mtu);
+        record((const int16_t *)buffs[0], n, flags);
+        return int(n);
+    }
+
+    size_t getNumDirectAccessBuffers(SoapySDR::Stream *)
+    {
+        return direct?1:0;
+    }
+
+    int acquireReadBuffer(SoapySDR::Stream *, size_t &handle, const void **buffs, int &flags, long long &timeNs, const long)
+    {
+        numAcquired++;
+        handle = 0;
+        buffs[0] = directBuff.data();
+        fill(directBuff.data(), mtu, flags, timeNs);
+        return int(mtu);
+    }
+
+    void releaseReadBuffer(SoapySDR::Stream *, const size_t)
+    {
+        numReleased++;
+    }
+
+    int acquireWriteBuffer(SoapySDR::Stream *, size_t &handle, void **buffs, const long)
+    {
+        numAcquired++;
+        handle = 0;
+        buffs[0] = directBuff.data();
+        return int(mtu);
+    }
+
+    void releaseWriteBuffer(SoapySDR::Stream *, const size_t, const size_t numElems, int &flags, const long long)
+    {
+        numReleased++;
+        record(directBuff.data(), numElems, flags);
+    }
+
+    const bool direct;
+    const size_t mtu;
+    size_t rxCount;
+    size_t numAcquired;
+    size_t numReleased;
+    std::vector<int16_t> directBuff;
+    std::vector<int16_t> txSamples;
+    std::vector<int> txFlags;
+    std::string setupFormat;
+    int numStreams;
+    bool failMTU;
+
+private:
+    void fill(int16_t *buff, const size_t numElems, int &flags, long long &timeNs)
+    {
+        flags = SOAPY_SDR_HAS_TIME;
+        timeNs = SoapySDR::ticksToTimeNs((long long)rxCount, 1e6);
+        for (size_t i = 0; i < numElems*2; i++)
+        {
+            buff[i] = int16_t((rxCount*2 + i) % 4096) - 2048;
+        }
+        rxCount += numElems;
+    }
+
+    void record(const int16_t *buff, const size_t numElems, const int flags)
+    {
+        txSamples.insert(txSamples.end(), buff, buff+numElems*2);
+        txFlags.push_back(flags);
+    }
+};
+
+//the expected value of the i-th received component
+static float expectedRx(const size_t i)
+{
+    return float(int(i % 4096) - 2048)/2048;
+}
+
+static bool checkRx(const bool direct)
+{
+    MockDevice device(direct, 100);
+    SoapySDR::StreamAdapter adapter(&device, SOAPY_SDR_RX, SOAPY_SDR_CF32);
+    if (adapter.isPassthrough() or adapter.usesDirectAccess() != direct) return false;
+    if (device.setupFormat != SOAPY_SDR_CS16 or adapter.getScaler() != 16.0) return false;
+    adapter.activate();
+
+    //reads smaller than the MTU split the direct access buffers into fragments
+    std::vector<float> buff(64*2);
+    void *buffs[1] = {buff.data()};
+    size_t total = 0;
+    while (total < 1000)
+    {
+        int flags(0);
+        long long timeNs(0);
+        const int ret = adapter.read(buffs, 64, flags, timeNs);
+        if (ret <= 0) return false;
+        if (timeNs != SoapySDR::ticksToTimeNs((long long)total, 1e6)) return false;
+        const bool fragment = (flags & SOAPY_SDR_MORE_FRAGMENTS) != 0;
+        if (fragment != (direct and (total + ret) % 100 != 0)) return false;
+        for (size_t i = 0; i < size_t(ret)*2; i++)
+        {
+            if (buff[i] != expectedRx(total*2+i)) return false;
+        }
+        total += ret;
+    }
+    adapter.deactivate();
+    return device.numAcquired == device.numReleased;
+}
+
+static bool checkTx(const bool direct)
+{
+    MockDevice device(direct, 100);
+    {
+        SoapySDR::StreamAdapter adapter(&device, SOAPY_SDR_TX, SOAPY_SDR_CF32);
+        if (adapter.isPassthrough() or adapter.usesDirectAccess() != direct) return false;
+        if (adapter.getScaler() != 1.0/16) return false;
+
+        std::vector<float> buff(250*2);
+        for (size_t i = 0; i < buff.size(); i++) buff[i] = expectedRx(i);
+        size_t total = 0;
+        while (total < 250)
+        {
+            const void *buffs[1] = {buff.data()+total*2};
+            int flags(SOAPY_SDR_END_BURST);
+            const int ret = adapter.write(buffs, 250-total, flags);
+            if (ret <= 0) return false;
+            total += ret;
+        }
+    }
+    if (device.numStreams != 0 or device.numAcquired != device.numReleased) return false;
+
+    //the end of burst flag is only passed with the last samples
+    if (device.txFlags.size() != 3) return false;
+    if (device.txFlags[0] != 0 or device.txFlags[1] != 0 or device.txFlags[2] != SOAPY_SDR_END_BURST) return false;
+    for (size_t i = 0; i < device.txSamples.size(); i++)
+    {
+        if (device.txSamples[i] != int16_t(int(i % 4096) - 2048)) return false;
+    }
+    return device.txSamples.size() == 250*2;
+}
+
+static bool checkPassthrough(void)
+{
+    MockDevice device(true, 100);
+    SoapySDR::StreamAdapter native(&device, SOAPY_SDR_RX, SOAPY_SDR_CS16);
+    if (not native.isPassthrough() or native.usesDirectAccess()) return false;
+
+    std::vector<int16_t> buff(50*2);
+    void *buffs[1] = {buff.data()};
+    int flags(0);
+    long long timeNs(0);
+    if (native.read(buffs, 50, flags, timeNs) != 50 or device.numAcquired != 0) return false;
+    if (buff[3] != int16_t(3 - 2048)) return false;
+
+    //a format the registry cannot reach is left to the driver
+    SoapySDR::StreamAdapter driver(&device, SOAPY_SDR_RX, "TEST_DRIVER_FORMAT");
+    if (not driver.isPassthrough() or device.setupFormat != "TEST_DRIVER_FORMAT") return false;
+
+    try
+    {
+        SoapySDR::StreamAdapter(&device, SOAPY_SDR_RX, "NOT_A_FORMAT");
+        return false;
+    }
+    catch (const std::runtime_error &) {}
+    return true;
+}
+
+static bool checkSetupFailure(void)
+{
+    //a stream that was set up is closed when the constructor throws
+    MockDevice device(false, 100);
+    device.failMTU = true;
+    try
+    {
+        SoapySDR::StreamAdapter(&device, SOAPY_SDR_RX, SOAPY_SDR_CF32);
+        return false;
+    }
+    catch (const std::runtime_error &) {}
+    return device.numStreams == 0;
+}
+
+int main(void)
+{
+    printf("Check converted receive:\n");
+    if (not checkRx(false)) return EXIT_FAILURE;
+    printf("Check direct access receive:\n");
+    if (not checkRx(true)) return EXIT_FAILURE;
+    printf("Check converted transmit:\n");
+    if (not checkTx(false)) return EXIT_FAILURE;
+    printf("Check direct access transmit:\n");
+    if (not checkTx(true)) return EXIT_FAILURE;
+    printf("Check passthrough:\n");
+    if (not checkPassthrough()) return EXIT_FAILURE;
+    printf("Check setup failure:\n");
+    if (not checkSetupFailure()) return EXIT_FAILURE;
+
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}